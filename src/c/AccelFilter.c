@@ -0,0 +1,120 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : AccelFilter.c
+
+   Last revision: 16 October 2026
+*/
+
+#include "AccelFilter.h"
+
+
+#define ACCELFILTER_MASK   (ACCELFILTER_CAPACITY - 1)
+
+
+void
+AccelFilter_initialize
+( AccelFilter       *filter
+, AccelFilterKernel  kernel
+, int16_t            seedX
+, int16_t            seedY
+, int16_t            seedZ
+)
+{
+  for (int i = 0  ;  i < ACCELFILTER_CAPACITY  ;  ++i)
+  {
+    filter->x[i] = seedX ;
+    filter->y[i] = seedY ;
+    filter->z[i] = seedZ ;
+  }
+
+  filter->sumX   = seedX * ACCELFILTER_CAPACITY ;
+  filter->sumY   = seedY * ACCELFILTER_CAPACITY ;
+  filter->sumZ   = seedZ * ACCELFILTER_CAPACITY ;
+  filter->emaX   = seedX * 256 ;
+  filter->emaY   = seedY * 256 ;
+  filter->emaZ   = seedZ * 256 ;
+  filter->speed  = 0 ;
+  filter->head   = 0 ;
+  filter->kernel = kernel ;
+}
+
+
+void
+AccelFilter_push
+( AccelFilter *filter
+, int16_t      x
+, int16_t      y
+, int16_t      z
+)
+{
+  const uint8_t head   = filter->head ;
+  const uint8_t newest = (head - 1) & ACCELFILTER_MASK ;
+
+  switch (filter->kernel)
+  {
+    case ACCELFILTER_KERNEL_EXPONENTIAL:
+      filter->emaX += ((x * 256) - filter->emaX) >> ACCELFILTER_EXPONENTIAL_LOG2 ;
+      filter->emaY += ((y * 256) - filter->emaY) >> ACCELFILTER_EXPONENTIAL_LOG2 ;
+      filter->emaZ += ((z * 256) - filter->emaZ) >> ACCELFILTER_EXPONENTIAL_LOG2 ;
+      break ;
+
+    case ACCELFILTER_KERNEL_ONEEURO:
+    {
+      // Sample speed (L1, mG/sample) against the previous raw sample, smoothed with a fixed 1/4 alpha.
+      const int32_t speed = abs( x - filter->x[newest] ) + abs( y - filter->y[newest] ) + abs( z - filter->z[newest] ) ;
+      filter->speed += ((speed * 256) - filter->speed) >> 2 ;
+
+      int32_t alpha = ACCELFILTER_ONEEURO_ALPHA_MIN + ((filter->speed * ACCELFILTER_ONEEURO_BETA_Q8) >> 16) ;
+
+      if (alpha > 256)
+        alpha = 256 ;
+
+      filter->emaX += (((x * 256) - filter->emaX) * alpha) >> 8 ;
+      filter->emaY += (((y * 256) - filter->emaY) * alpha) >> 8 ;
+      filter->emaZ += (((z * 256) - filter->emaZ) * alpha) >> 8 ;
+      break ;
+    }
+
+    case ACCELFILTER_KERNEL_BOXCAR:
+    default:
+      break ;
+  }
+
+  // The ring is kept for every kernel: the one euro kernel needs the previous sample, and other readers may want raw history.
+  filter->sumX += x - filter->x[head] ;
+  filter->sumY += y - filter->y[head] ;
+  filter->sumZ += z - filter->z[head] ;
+
+  filter->x[head] = x ;
+  filter->y[head] = y ;
+  filter->z[head] = z ;
+
+  filter->head = (head + 1) & ACCELFILTER_MASK ;
+}
+
+
+void
+AccelFilter_get
+( const AccelFilter *filter
+, int32_t           *x
+, int32_t           *y
+, int32_t           *z
+)
+{
+  switch (filter->kernel)
+  {
+    case ACCELFILTER_KERNEL_EXPONENTIAL:
+    case ACCELFILTER_KERNEL_ONEEURO:
+      *x = filter->emaX >> 8 ;
+      *y = filter->emaY >> 8 ;
+      *z = filter->emaZ >> 8 ;
+      break ;
+
+    case ACCELFILTER_KERNEL_BOXCAR:
+    default:
+      *x = filter->sumX >> ACCELFILTER_CAPACITY_LOG2 ;
+      *y = filter->sumY >> ACCELFILTER_CAPACITY_LOG2 ;
+      *z = filter->sumZ >> ACCELFILTER_CAPACITY_LOG2 ;
+      break ;
+  }
+}
@@ -0,0 +1,72 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : AccelFilter.h
+
+   Last revision: 16 October 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+
+
+// Power of two capacity: the boxcar mean is a shift and the ring index a mask.
+#define ACCELFILTER_CAPACITY_LOG2         3
+#define ACCELFILTER_CAPACITY              (1 << ACCELFILTER_CAPACITY_LOG2)
+
+// Exponential kernel: alpha = 1 / 2^ACCELFILTER_EXPONENTIAL_LOG2
+#define ACCELFILTER_EXPONENTIAL_LOG2      2
+
+// One euro kernel: alpha (Q8) grows from ALPHA_MIN with the smoothed sample speed (mG/sample) times BETA.
+// Tuned so +-12 mG rest jitter (24 mG/sample) gets the exponential kernel alpha (64), faster moves less lag.
+#define ACCELFILTER_ONEEURO_ALPHA_MIN     8
+#define ACCELFILTER_ONEEURO_BETA_Q8       512
+
+
+typedef enum { ACCELFILTER_KERNEL_BOXCAR         // Mean of the last ACCELFILTER_CAPACITY samples.
+             , ACCELFILTER_KERNEL_EXPONENTIAL    // Exponential moving average.
+             , ACCELFILTER_KERNEL_ONEEURO        // Speed adaptive exponential: smooth at rest, low lag while moving.
+             }
+AccelFilterKernel ;
+
+
+typedef struct
+{ int16_t            x[ACCELFILTER_CAPACITY] ;   // Structure of arrays: one ring per axis.
+  int16_t            y[ACCELFILTER_CAPACITY] ;
+  int16_t            z[ACCELFILTER_CAPACITY] ;
+  int32_t            sumX, sumY, sumZ ;          // Running sums of the rings.
+  int32_t            emaX, emaY, emaZ ;          // Exponential kernels state (Q8).
+  int32_t            speed ;                     // One euro kernel smoothed sample speed (Q8).
+  uint8_t            head ;                      // Ring index of the oldest sample.
+  AccelFilterKernel  kernel ;
+} AccelFilter ;
+
+
+// Fills the whole ring (and kernel state) with the seed sample.
+void
+AccelFilter_initialize
+( AccelFilter       *filter
+, AccelFilterKernel  kernel
+, int16_t            seedX
+, int16_t            seedY
+, int16_t            seedZ
+) ;
+
+
+void
+AccelFilter_push
+( AccelFilter *filter
+, int16_t      x
+, int16_t      y
+, int16_t      z
+) ;
+
+
+// Filtered value according to the filter kernel.
+void
+AccelFilter_get
+( const AccelFilter *filter
+, int32_t           *x
+, int32_t           *y
+, int32_t           *z
+) ;
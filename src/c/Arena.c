@@ -0,0 +1,337 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Arena.c
+
+   Last revision: 16 October 2026
+*/
+
+#include "Arena.h"
+#include "HeapCheck.h"
+
+#if defined(ARENA) || defined(HEAP_CHECK)
+
+// Linked with -Wl,--wrap=<name>: __real_<name> is the SDK implementation.
+void *__real_malloc ( size_t size ) ;
+void *__real_calloc ( size_t count, size_t size ) ;
+void *__real_realloc( void *ptr, size_t size ) ;
+void  __real_free   ( void *ptr ) ;
+
+#endif
+
+
+#if defined(ARENA)
+
+// Each block is preceded by a header word: the block bytes, header included, with bit 0 set while free. Blocks are
+// word aligned (Cortex-M: no wider alignment needed) and tile the arena from its start up to s_arena_end.
+#define ARENA_ALIGN(bytes)     (((bytes) + 3) & ~(size_t)3)
+#define ARENA_HEADER           sizeof(uint32_t)
+#define ARENA_FREE             1u
+#define ARENA_SPLIT_MIN        (ARENA_HEADER + 8)    // Smallest free block worth splitting off.
+
+static uint8_t  *s_arena_data    = NULL ;
+static size_t    s_arena_size    = 0 ;
+static size_t    s_arena_end     = 0 ;    // Blocks extent, the rest of the arena was never carved.
+static size_t    s_arena_live    = 0 ;    // Bytes in live blocks.
+static size_t    s_arena_peak    = 0 ;    // Highest s_arena_end.
+static size_t    s_arena_spilled = 0 ;
+static bool      s_arena_isOpen  = false ;
+
+
+static
+bool
+arena_owns
+( const void *ptr )
+{
+  return s_arena_data != NULL
+      && (const uint8_t *)ptr >= s_arena_data
+      && (const uint8_t *)ptr <  s_arena_data + s_arena_size ;
+}
+
+
+static
+uint32_t *
+arena_header
+( const void *ptr )
+{
+  return (uint32_t *)((uint8_t *)ptr - ARENA_HEADER) ;
+}
+
+
+static
+void *
+arena_carve
+( size_t size )
+{ // First fit over the free blocks, merging free neighbours on the way, else carved past s_arena_end.
+  if (size > s_arena_size)
+  {
+    s_arena_spilled += size ;
+    return NULL ;
+  }
+
+  const uint32_t blockBytes = ARENA_HEADER + ARENA_ALIGN(size) ;
+  size_t         offset     = 0 ;
+
+  while (offset < s_arena_end)
+  {
+    uint32_t *header = (uint32_t *)(s_arena_data + offset) ;
+
+    if (*header & ARENA_FREE)
+    {
+      uint32_t bytes = *header & ~ARENA_FREE ;
+
+      while (offset + bytes < s_arena_end  &&  (*(uint32_t *)(s_arena_data + offset + bytes) & ARENA_FREE))
+        bytes += *(uint32_t *)(s_arena_data + offset + bytes) & ~ARENA_FREE ;
+
+      if (offset + bytes == s_arena_end)    // Free up to the end: give it back to the uncarved rest.
+      {
+        s_arena_end = offset ;
+        break ;
+      }
+
+      *header = bytes | ARENA_FREE ;
+
+      if (bytes >= blockBytes)
+      {
+        if (bytes - blockBytes >= ARENA_SPLIT_MIN)
+        {
+          *(uint32_t *)(s_arena_data + offset + blockBytes) = (bytes - blockBytes) | ARENA_FREE ;
+          bytes = blockBytes ;
+        }
+
+        *header       = bytes ;
+        s_arena_live += bytes ;
+        return header + 1 ;
+      }
+    }
+
+    offset += *header & ~ARENA_FREE ;
+  }
+
+  if (s_arena_end + blockBytes > s_arena_size)
+  {
+    s_arena_spilled += size ;
+    return NULL ;
+  }
+
+  uint32_t *header = (uint32_t *)(s_arena_data + s_arena_end) ;
+
+  *header       = blockBytes ;
+  s_arena_end  += blockBytes ;
+  s_arena_live += blockBytes ;
+
+  if (s_arena_end > s_arena_peak)
+    s_arena_peak = s_arena_end ;
+
+  return header + 1 ;
+}
+
+
+static
+void
+arena_release
+( void *ptr )
+{
+  uint32_t *header = arena_header( ptr ) ;
+
+  s_arena_live -= *header ;
+  *header      |= ARENA_FREE ;
+
+  if ((uint8_t *)header + *header - ARENA_FREE == s_arena_data + s_arena_end)    // Top block: uncarve it at once.
+    s_arena_end = (uint8_t *)header - s_arena_data ;
+}
+
+#endif
+
+
+#if defined(ARENA) || defined(HEAP_CHECK)
+
+void *
+__wrap_malloc
+( size_t size )
+{
+  HEAP_CHECK_CALL( ) ;
+
+#if defined(ARENA)
+  void *ptr = s_arena_isOpen ? arena_carve( size ) : NULL ;
+
+  if (ptr != NULL)
+    return ptr ;
+#endif
+
+  return __real_malloc( size ) ;
+}
+
+
+void *
+__wrap_calloc
+( size_t count
+, size_t size
+)
+{
+  HEAP_CHECK_CALL( ) ;
+
+  if (size != 0  &&  count > SIZE_MAX / size)    // count * size would overflow.
+    return NULL ;
+
+#if defined(ARENA)
+  void *ptr = s_arena_isOpen ? arena_carve( count * size ) : NULL ;
+
+  if (ptr != NULL)
+  {
+    memset( ptr, 0, count * size ) ;
+    return ptr ;
+  }
+#endif
+
+  return __real_calloc( count, size ) ;
+}
+
+
+void *
+__wrap_realloc
+( void   *ptr
+, size_t  size
+)
+{
+  HEAP_CHECK_CALL( ) ;
+
+#if defined(ARENA)
+  if (arena_owns( ptr ))
+  {
+    const size_t oldSize = (*arena_header( ptr ) & ~ARENA_FREE) - ARENA_HEADER ;
+
+    if (size <= oldSize)    // Shrinking: keep the block.
+      return ptr ;
+
+    void *moved = s_arena_isOpen ? arena_carve( size ) : NULL ;
+
+    if (moved == NULL)
+      moved = __real_malloc( size ) ;
+
+    if (moved == NULL)
+      return NULL ;    // The old block stays valid.
+
+    memcpy( moved, ptr, oldSize ) ;
+    arena_release( ptr ) ;
+    return moved ;
+  }
+#endif
+
+  return __real_realloc( ptr, size ) ;
+}
+
+
+void
+__wrap_free
+( void *ptr )
+{
+  if (ptr == NULL)
+    return ;
+
+  HEAP_CHECK_CALL( ) ;
+
+#if defined(ARENA)
+  if (arena_owns( ptr ))
+  {
+    arena_release( ptr ) ;
+    return ;
+  }
+#endif
+
+  __real_free( ptr ) ;
+}
+
+#endif
+
+
+#if defined(ARENA)
+
+bool
+Arena_initialize
+( size_t bytes )
+{
+  s_arena_data    = __real_malloc( bytes ) ;
+  s_arena_size    = s_arena_data != NULL ? bytes : 0 ;
+  s_arena_end     = 0 ;
+  s_arena_live    = 0 ;
+  s_arena_peak    = 0 ;
+  s_arena_spilled = 0 ;
+
+  if (s_arena_data == NULL)
+  {
+    LOGW( "Arena_initialize:: %u bytes do not fit in the heap, world objects go to the heap", (unsigned)bytes ) ;
+    return false ;
+  }
+
+  return true ;
+}
+
+
+void
+Arena_finalize
+( )
+{
+  __real_free( s_arena_data ) ;
+
+  s_arena_data   = NULL ;
+  s_arena_size   = 0 ;
+  s_arena_isOpen = false ;
+}
+
+
+void
+Arena_open
+( )
+{
+  s_arena_isOpen = true ;
+}
+
+
+void
+Arena_close
+( )
+{
+  s_arena_isOpen = false ;
+}
+
+
+size_t
+Arena_size
+( )
+{
+  return s_arena_size ;
+}
+
+
+size_t
+Arena_used
+( )
+{
+  return s_arena_live ;
+}
+
+
+size_t
+Arena_peak
+( )
+{
+  return s_arena_peak ;
+}
+
+
+size_t
+Arena_headroom
+( )
+{
+  return s_arena_size - s_arena_peak ;
+}
+
+
+size_t
+Arena_spilled
+( )
+{
+  return s_arena_spilled ;
+}
+
+#endif
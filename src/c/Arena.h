@@ -0,0 +1,45 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Arena.h
+
+   Last revision: 16 October 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include "Config.h"
+
+
+// ARENA is set by wscript (ARENA = True), it also links malloc/calloc/realloc/free through the Arena.c wrappers
+// (-Wl,--wrap): between Arena_open( ) and Arena_close( ) every allocation, the prebuilt karambola library included,
+// comes from one block taken from the heap at app_init( ), first fit over a free list. A free( ) of an arena block
+// gives it back to that list whenever it happens, neighbouring free blocks are merged. An allocation not fitting in
+// the arena spills to the heap.
+#if defined(ARENA)
+
+  bool    Arena_initialize( size_t bytes ) ;    // Takes the arena block from the heap, false if it does not fit.
+  void    Arena_finalize  ( ) ;                 // Gives it back, every arena allocation included.
+
+  void    Arena_open      ( ) ;                 // Allocations from here ...
+  void    Arena_close     ( ) ;                 // ... to here come from the arena.
+
+  size_t  Arena_size      ( ) ;                 // Arena block bytes, 0 if it did not fit in the heap.
+  size_t  Arena_used      ( ) ;                 // Bytes in live blocks now (headers & alignment included).
+  size_t  Arena_peak      ( ) ;                 // Highest arena extent (live and free blocks) seen.
+  size_t  Arena_headroom  ( ) ;                 // Arena_size( ) - Arena_peak( ).
+  size_t  Arena_spilled   ( ) ;                 // Bytes asked while open that went to the heap instead.
+
+  #define ARENA_INITIALIZE(bytes)    Arena_initialize( bytes )
+  #define ARENA_FINALIZE()           Arena_finalize( )
+  #define ARENA_OPEN()               Arena_open( )
+  #define ARENA_CLOSE()              Arena_close( )
+
+#else
+
+  #define ARENA_INITIALIZE(bytes)
+  #define ARENA_FINALIZE()
+  #define ARENA_OPEN()
+  #define ARENA_CLOSE()
+
+#endif
@@ -17,6 +17,36 @@
 // Uncoment next line to "fake" running on APLITE/DIORITE B&W platforms.
 //#undef PBL_COLOR
 
+// Uncommenting the next 3 lines will do the camera & spin math in integer/fixed point on the FPU-less B&W platforms.
+// Only worth it if the BENCH "cam viewPoint" timing shows the fixed point path faster there, float is used until then.
+//#if !defined(PBL_COLOR)
+//  #define FIXED_POINT
+//#endif
+
+// Uncommenting the next line will enable the per stage hot path timings (Profile.h), reported on app exit.
+//#define PROFILE
+
+// Uncommenting the next line will record every input (tick, tap, button, accel) and log it on app exit as a C initializer.
+// Sessions up to ~2.5 minutes of DYNAMIC mode or ~34 minutes of STEADY mode fit (RECORDER_CAPACITY), longer ones are truncated.
+//#define RECORD
+
+// Uncommenting the next line will replay src/c/ReplayLog.inc (a RECORD log) frame by frame instead of the live inputs, then exit.
+//#define REPLAY
+
+#if defined(RECORD) && defined(REPLAY)
+  #error "RECORD and REPLAY are mutually exclusive."
+#endif
+
+// Uncommenting the next line will build the frame time benchmark (runs on QEMU, logs results and exits).
+//#define BENCH
+
+// Commenting the next line will disable the battery & frame cost driven quality governor (Governor.h).
+#define GOVERNOR
+
+#if defined(BENCH) || defined(REPLAY)    // Both need the same quality on every frame.
+  #undef GOVERNOR
+#endif
+
 #if defined(LOG)
   #define LOGD(fmt, ...) APP_LOG(APP_LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
   #define LOGI(fmt, ...) APP_LOG(APP_LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
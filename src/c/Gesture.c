@@ -0,0 +1,122 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Gesture.c
+
+   Last revision: 16 October 2026
+*/
+
+#include "Gesture.h"
+
+
+void
+GestureRecognizer_initialize
+( GestureRecognizer *recognizer
+, int16_t            seedX
+, int16_t            seedY
+, int16_t            seedZ
+)
+{
+  recognizer->gravityX     = seedX * 256 ;
+  recognizer->gravityY     = seedY * 256 ;
+  recognizer->gravityZ     = seedZ * 256 ;
+  recognizer->peak         = 0 ;
+  recognizer->peakAxis     = 0 ;
+  recognizer->inSpike      = false ;
+  recognizer->spikeSamples = 0 ;
+  recognizer->sinceSpike   = UINT8_MAX ;
+  recognizer->groupSpikes  = 0 ;
+}
+
+
+GestureType
+GestureRecognizer_push
+( GestureRecognizer *recognizer
+, int16_t            x
+, int16_t            y
+, int16_t            z
+, int16_t           *strength
+)
+{
+  static const GestureType groupGestures[] = { GESTURE_PUNCH, GESTURE_TWIST, GESTURE_SHAKE } ;    // By peakAxis.
+
+  // Dynamic acceleration: sample minus gravity, dominant axis only (L-infinity).
+  const int32_t dx = abs( x - (recognizer->gravityX >> 8) ) ;
+  const int32_t dy = abs( y - (recognizer->gravityY >> 8) ) ;
+  const int32_t dz = abs( z - (recognizer->gravityZ >> 8) ) ;
+
+  int32_t magnitude = dx ;
+  uint8_t axis      = 0 ;
+
+  if (dy > magnitude) { magnitude = dy ; axis = 1 ; }
+  if (dz > magnitude) { magnitude = dz ; axis = 2 ; }
+
+  if (magnitude >= GESTURE_SPIKE_THRESHOLD)
+  {
+    if (!recognizer->inSpike)
+    {
+      if (recognizer->sinceSpike > GESTURE_SHAKE_GAP)    // First spike of a new group.
+      {
+        recognizer->groupSpikes = 0 ;
+        recognizer->peak        = 0 ;
+      }
+
+      recognizer->inSpike      = true ;
+      recognizer->spikeSamples = 0 ;
+
+      if (recognizer->groupSpikes < UINT8_MAX)
+        ++recognizer->groupSpikes ;
+    }
+
+    recognizer->sinceSpike = 0 ;
+
+    if (++recognizer->spikeSamples > GESTURE_SPIKE_MAX)
+    { // Posture change: restart the gravity estimate from here, drop the whole group.
+      recognizer->gravityX    = x * 256 ;
+      recognizer->gravityY    = y * 256 ;
+      recognizer->gravityZ    = z * 256 ;
+      recognizer->inSpike     = false ;
+      recognizer->sinceSpike  = UINT8_MAX ;
+      recognizer->groupSpikes = 0 ;
+      return GESTURE_NONE ;
+    }
+
+    if (magnitude > recognizer->peak)
+    {
+      recognizer->peak     = magnitude > GESTURE_STRENGTH_MAX ? GESTURE_STRENGTH_MAX : magnitude ;
+      recognizer->peakAxis = axis ;
+    }
+
+    return GESTURE_NONE ;    // Gravity estimate frozen during the spike.
+  }
+
+  recognizer->gravityX += ((x * 256) - recognizer->gravityX) >> GESTURE_GRAVITY_LOG2 ;
+  recognizer->gravityY += ((y * 256) - recognizer->gravityY) >> GESTURE_GRAVITY_LOG2 ;
+  recognizer->gravityZ += ((z * 256) - recognizer->gravityZ) >> GESTURE_GRAVITY_LOG2 ;
+
+  if (recognizer->sinceSpike < UINT8_MAX)
+    ++recognizer->sinceSpike ;
+
+  if (recognizer->inSpike)
+  { // Spike just ended: a shake needs no more waiting, later spikes of the same group are part of it.
+    recognizer->inSpike = false ;
+
+    if (recognizer->groupSpikes == GESTURE_SHAKE_SPIKES)
+    {
+      *strength = recognizer->peak ;
+      return GESTURE_SHAKE ;
+    }
+  }
+
+  // No next spike can join the group from here on: too short for a shake, it is a punch, a twist or a Z tap.
+  if ( recognizer->sinceSpike  == GESTURE_SHAKE_GAP + 1
+    && recognizer->groupSpikes >  0
+    && recognizer->groupSpikes <  GESTURE_SHAKE_SPIKES
+     )
+  {
+    recognizer->groupSpikes = 0 ;
+    *strength               = recognizer->peak ;
+    return groupGestures[recognizer->peakAxis] ;
+  }
+
+  return GESTURE_NONE ;
+}
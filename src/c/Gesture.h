@@ -0,0 +1,64 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Gesture.h
+
+   Last revision: 16 October 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+
+
+// Thresholds in mG over the gravity estimate, durations in samples (25Hz => 40ms each).
+#define GESTURE_SPIKE_THRESHOLD     700     // Dynamic acceleration that starts/keeps a spike.
+#define GESTURE_STRENGTH_MAX       4000     // Spike peaks are clamped here.
+#define GESTURE_SPIKE_MAX             6     // Longer spikes are a posture change, not a gesture.
+#define GESTURE_SHAKE_GAP             3     // Max rest samples between consecutive spikes of a group (shake).
+#define GESTURE_SHAKE_SPIKES          3     // Spikes in a group making a shake.
+
+// Gravity estimate: alpha = 1 / 2^GESTURE_GRAVITY_LOG2, not updated during spikes.
+#define GESTURE_GRAVITY_LOG2          3
+
+
+typedef enum { GESTURE_NONE
+             , GESTURE_PUNCH      // Group of less than GESTURE_SHAKE_SPIKES spikes, strongest dominant on X.
+             , GESTURE_TWIST      // Group of less than GESTURE_SHAKE_SPIKES spikes, strongest dominant on Y.
+             , GESTURE_SHAKE      // GESTURE_SHAKE_SPIKES spikes or more, any axis. Or fewer, strongest dominant on Z:
+             }                    // what a firmware tap on Z is taken for too.
+GestureType ;
+
+
+typedef struct
+{ int32_t   gravityX, gravityY, gravityZ ;   // Slow gravity estimate (Q8).
+  int16_t   peak ;                           // Current group strongest spike peak (mG).
+  uint8_t   peakAxis ;                       // Current group strongest spike dominant axis: 0 = X, 1 = Y, 2 = Z.
+  bool      inSpike ;
+  uint8_t   spikeSamples ;                   // Samples of the current spike.
+  uint8_t   sinceSpike ;                     // Rest samples since the last spike sample (saturates).
+  uint8_t   groupSpikes ;                    // Spikes in the current group, 0 once reported.
+} GestureRecognizer ;
+
+
+// Seeds the gravity estimate with the resting sample.
+void
+GestureRecognizer_initialize
+( GestureRecognizer *recognizer
+, int16_t            seedX
+, int16_t            seedY
+, int16_t            seedZ
+) ;
+
+
+// Feeds one raw sample. Spikes apart by at most GESTURE_SHAKE_GAP rest samples form a group. A shake is
+// reported as soon as its GESTURE_SHAKE_SPIKES-th spike ends, a shorter group (a shake may start like one)
+// on the rest sample after its GESTURE_SHAKE_GAP-th: the earliest one a next spike could no longer join it. The
+// strength is the group strongest spike peak (mG, up to GESTURE_STRENGTH_MAX).
+GestureType
+GestureRecognizer_push
+( GestureRecognizer *recognizer
+, int16_t            x
+, int16_t            y
+, int16_t            z
+, int16_t           *strength
+) ;
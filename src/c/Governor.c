@@ -0,0 +1,112 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Governor.c
+
+   Last revision: 16 October 2026
+*/
+
+#include "Governor.h"
+
+
+// Quality tiers, cheapest last. Animation steps stay wall clock based, so a longer interval skips frames, not time.
+static const GovernorTier s_governor_tiers[] = { { .interval_ms =  40, .hundredths = true , .wireframe = false }    // 25 fps.
+                                               , { .interval_ms =  50, .hundredths = true , .wireframe = false }    // 20 fps.
+                                               , { .interval_ms =  66, .hundredths = false, .wireframe = false }    // 15 fps, hundredths frozen.
+                                               , { .interval_ms = 100, .hundredths = false, .wireframe = true  }    // 10 fps, wireframe.
+                                               } ;
+
+#define GOVERNOR_TIERS   (sizeof(s_governor_tiers) / sizeof(s_governor_tiers[0]))
+
+
+static
+bool
+governor_retier
+( Governor *governor )
+{
+  const uint8_t tier = governor->loadTier > governor->batteryTier ? governor->loadTier : governor->batteryTier ;
+
+  if (tier == governor->tier)
+    return false ;
+
+  APP_LOG( APP_LOG_LEVEL_INFO
+         , "Governor tier %d -> %d (load %d, battery %d): %d ms, hundredths %s, wireframe %s, avg frame cost %d ms"
+         , governor->tier, tier, governor->loadTier, governor->batteryTier
+         , s_governor_tiers[tier].interval_ms
+         , s_governor_tiers[tier].hundredths ? "on" : "off"
+         , s_governor_tiers[tier].wireframe  ? "on" : "off"
+         , (int)(governor->costEma >> 8)
+         ) ;
+
+  governor->tier = tier ;
+  return true ;
+}
+
+
+void
+Governor_initialize
+( Governor *governor )
+{
+  governor->costEma     = 0 ;
+  governor->holdFrames  = GOVERNOR_HOLD_FRAMES ;
+  governor->loadTier    = 0 ;
+  governor->batteryTier = 0 ;
+  governor->tier        = 0 ;
+}
+
+
+bool
+Governor_frameCost
+( Governor *governor
+, uint32_t  cost_ms
+)
+{
+  governor->costEma += (((int32_t)cost_ms * 256) - governor->costEma) >> GOVERNOR_COST_EMA_LOG2 ;
+
+  if (governor->holdFrames > 0)
+  {
+    --governor->holdFrames ;
+    return false ;
+  }
+
+  const int32_t costPct = (governor->costEma * 100) >> 8 ;    // Average frame cost (ms) x 100, against % x interval.
+  const uint8_t load    = governor->loadTier ;
+
+  if (load < GOVERNOR_TIERS - 1  &&  costPct > GOVERNOR_COST_DOWN_PCT * s_governor_tiers[load].interval_ms)
+    ++governor->loadTier ;
+  else if (load > 0  &&  costPct < GOVERNOR_COST_UP_PCT * s_governor_tiers[load - 1].interval_ms)
+    --governor->loadTier ;
+  else
+    return false ;
+
+  governor->holdFrames = GOVERNOR_HOLD_FRAMES ;
+  return governor_retier( governor ) ;
+}
+
+
+bool
+Governor_battery
+( Governor           *governor
+, BatteryChargeState  state
+)
+{
+  if (state.is_charging  ||  state.is_plugged)
+    governor->batteryTier = 0 ;
+  else if (state.charge_percent <= GOVERNOR_BATTERY_LOWEST_PCT)
+    governor->batteryTier = 3 ;
+  else if (state.charge_percent <= GOVERNOR_BATTERY_LOWER_PCT)
+    governor->batteryTier = 2 ;
+  else if (state.charge_percent <= GOVERNOR_BATTERY_LOW_PCT)
+    governor->batteryTier = 1 ;
+  else
+    governor->batteryTier = 0 ;
+
+  return governor_retier( governor ) ;
+}
+
+
+const GovernorTier *
+Governor_tier
+( const Governor *governor )
+{
+  return &s_governor_tiers[governor->tier] ;
+}
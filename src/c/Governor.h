@@ -0,0 +1,69 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Governor.h
+
+   Last revision: 16 October 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+
+
+// Frame cost (update + draw) exponential moving average: alpha = 1 / 2^GOVERNOR_COST_EMA_LOG2
+#define GOVERNOR_COST_EMA_LOG2        3
+
+// Step down when the average frame cost exceeds this % of the tier frame interval, back up when it
+// would fit within GOVERNOR_COST_UP_PCT of the better tier interval.
+#define GOVERNOR_COST_DOWN_PCT       75
+#define GOVERNOR_COST_UP_PCT         40
+
+// Frames between two load driven tier changes: lets the average settle, avoids tier flapping.
+#define GOVERNOR_HOLD_FRAMES         50
+
+// Battery floor: not charging and at or below this charge % => at least tier 1, 2, 3.
+#define GOVERNOR_BATTERY_LOW_PCT     30
+#define GOVERNOR_BATTERY_LOWER_PCT   20
+#define GOVERNOR_BATTERY_LOWEST_PCT  10
+
+
+typedef struct
+{ uint16_t  interval_ms ;     // Animation timer interval.
+  bool      hundredths ;      // Hundredths digits animated.
+  bool      wireframe ;       // Transparency mode forced to MESH_TRANSPARENCY_WIREFRAME.
+} GovernorTier ;
+
+
+typedef struct
+{ int32_t   costEma ;         // Average frame cost (ms, Q8).
+  uint16_t  holdFrames ;      // Frames left before the next load driven change.
+  uint8_t   loadTier ;        // Tier asked by the frame costs.
+  uint8_t   batteryTier ;     // Tier floor asked by the battery.
+  uint8_t   tier ;            // Current tier: max( loadTier, batteryTier ).
+} Governor ;
+
+
+void
+Governor_initialize
+( Governor *governor ) ;
+
+
+// Feeds the cost of one drawn frame. Returns true if the tier changed.
+bool
+Governor_frameCost
+( Governor *governor
+, uint32_t  cost_ms
+) ;
+
+
+// Feeds a battery state. Returns true if the tier changed.
+bool
+Governor_battery
+( Governor           *governor
+, BatteryChargeState  state
+) ;
+
+
+const GovernorTier *
+Governor_tier
+( const Governor *governor ) ;
@@ -0,0 +1,77 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : HeapCheck.c
+
+   Last revision: 16 October 2026
+*/
+
+#include "HeapCheck.h"
+
+#if defined(HEAP_CHECK)
+
+static bool      s_heapCheck_inFrame       = false ;
+static int       s_heapCheck_frame         = 0 ;      // world_update( ) count of the current frame.
+static uint32_t  s_heapCheck_frameCalls    = 0 ;      // Heap calls within the current frame.
+static uint32_t  s_heapCheck_framesChecked = 0 ;      // world_update( ), world_draw( ) and accel batch passes, each.
+static uint32_t  s_heapCheck_framesFailed  = 0 ;
+static uint32_t  s_heapCheck_callsFailed   = 0 ;
+
+
+void
+HeapCheck_call
+( )
+{
+  s_heapCheck_frameCalls += s_heapCheck_inFrame ;
+}
+
+
+void
+HeapCheck_frameBegin
+( int frame )
+{
+  s_heapCheck_frame      = frame ;
+  s_heapCheck_frameCalls = 0 ;
+  s_heapCheck_inFrame    = frame > HEAPCHECK_WARMUP_FRAMES ;
+}
+
+
+void
+HeapCheck_frameEnd
+( )
+{
+  if (!s_heapCheck_inFrame)
+    return ;
+
+  s_heapCheck_inFrame = false ;
+  ++s_heapCheck_framesChecked ;
+
+  if (s_heapCheck_frameCalls > 0)
+  {
+    ++s_heapCheck_framesFailed ;
+    s_heapCheck_callsFailed += s_heapCheck_frameCalls ;
+    APP_LOG( APP_LOG_LEVEL_ERROR, "HEAP_CHECK frame %d: %d heap calls", s_heapCheck_frame, (int)s_heapCheck_frameCalls ) ;
+  }
+}
+
+
+void
+HeapCheck_report
+( )
+{
+  APP_LOG( s_heapCheck_framesFailed > 0 ? APP_LOG_LEVEL_ERROR : APP_LOG_LEVEL_INFO
+         , "HEAP_CHECK %s: %d update/draw/accel passes checked after %d warm-up frames, %d with heap calls (%d calls)"
+         , s_heapCheck_framesFailed > 0 ? "FAIL" : "PASS"
+         , (int)s_heapCheck_framesChecked, HEAPCHECK_WARMUP_FRAMES
+         , (int)s_heapCheck_framesFailed, (int)s_heapCheck_callsFailed
+         ) ;
+}
+
+
+uint32_t
+HeapCheck_callsFailed
+( )
+{
+  return s_heapCheck_callsFailed ;
+}
+
+#endif
@@ -0,0 +1,42 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : HeapCheck.h
+
+   Last revision: 16 October 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include "Config.h"
+
+
+// Frames after world_start( ) before heap use within a frame counts as a violation.
+#define HEAPCHECK_WARMUP_FRAMES   50
+
+
+// HEAP_CHECK is set by wscript (HEAP_CHECK = True). The Arena.c malloc/calloc/realloc/free wrappers report
+// every call: every caller is counted, the prebuilt karambola library included.
+#if defined(HEAP_CHECK)
+
+  void  HeapCheck_call      ( ) ;              // One heap call, from the Arena.c wrappers.
+
+  void  HeapCheck_frameBegin( int frame ) ;    // Counts heap calls from here ...
+  void  HeapCheck_frameEnd  ( ) ;              // ... to here, logs an error if any after warm-up.
+  void  HeapCheck_report    ( ) ;              // Logs PASS/FAIL: passes checked, passes & calls violating.
+
+  uint32_t  HeapCheck_callsFailed( ) ;         // Heap calls within passes checked so far.
+
+  #define HEAP_CHECK_CALL()              HeapCheck_call( )
+  #define HEAP_CHECK_FRAME_BEGIN(frame)  HeapCheck_frameBegin( frame )
+  #define HEAP_CHECK_FRAME_END()         HeapCheck_frameEnd( )
+  #define HEAP_CHECK_REPORT()            HeapCheck_report( )
+
+#else
+
+  #define HEAP_CHECK_CALL()
+  #define HEAP_CHECK_FRAME_BEGIN(frame)
+  #define HEAP_CHECK_FRAME_END()
+  #define HEAP_CHECK_REPORT()
+
+#endif
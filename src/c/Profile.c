@@ -0,0 +1,126 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Profile.c
+
+   Last revision: 16 October 2026
+*/
+
+#include "Profile.h"
+#include "Arena.h"
+#include "Timing.h"
+
+#if defined(PROFILE)
+
+typedef struct
+{ uint16_t  samples[PROFILE_SAMPLES] ;   // Ring buffer of the latest durations (ms).
+  uint32_t  count ;                      // Samples recorded since app start.
+  uint32_t  start_ms ;                   // Pending Profile_begin( ), 0 if none.
+} ProfileStageLog ;
+
+static ProfileStageLog  s_profile_stages[PROFILE_STAGES] ;
+
+static const char *s_profile_stageNames[PROFILE_STAGES] = { "accel", "animation", "camera", "draw SOLID", "draw XRAY", "draw WIREFRAME", "timer->draw" } ;
+
+#if defined(PBL_PLATFORM_APLITE)
+  #define PROFILE_PLATFORM   "aplite"
+#elif defined(PBL_PLATFORM_BASALT)
+  #define PROFILE_PLATFORM   "basalt"
+#elif defined(PBL_PLATFORM_CHALK)
+  #define PROFILE_PLATFORM   "chalk"
+#elif defined(PBL_PLATFORM_DIORITE)
+  #define PROFILE_PLATFORM   "diorite"
+#elif defined(PBL_PLATFORM_EMERY)
+  #define PROFILE_PLATFORM   "emery"
+#else
+  #define PROFILE_PLATFORM   "unknown"
+#endif
+
+
+void
+Profile_begin
+( ProfileStage stage )
+{
+  s_profile_stages[stage].start_ms = Timing_nowMs( ) | 1 ;    // Never 0: 0 means no pending begin. 1ms error at most.
+}
+
+
+void
+Profile_end
+( ProfileStage stage )
+{
+  ProfileStageLog *log = s_profile_stages + stage ;
+
+  if (log->start_ms == 0)     // e.g. a world_draw( ) not triggered by the update timer.
+    return ;
+
+  const uint32_t duration = Timing_nowMs( ) - log->start_ms ;
+
+  log->samples[log->count & (PROFILE_SAMPLES - 1)] = duration > UINT16_MAX ? UINT16_MAX : duration ;
+  log->start_ms = 0 ;
+  ++log->count ;
+}
+
+
+void
+Profile_heap
+( const char *label )
+{
+#if defined(ARENA)
+  APP_LOG( APP_LOG_LEVEL_INFO, "PROFILE arena %s %s: used=%u of %u", PROFILE_PLATFORM, label, (unsigned)Arena_used( ), (unsigned)Arena_size( ) ) ;
+#else
+  APP_LOG( APP_LOG_LEVEL_INFO, "PROFILE heap %s %s: used=%u, free=%u", PROFILE_PLATFORM, label, (unsigned)heap_bytes_used( ), (unsigned)heap_bytes_free( ) ) ;
+#endif
+}
+
+
+void
+Profile_report
+( uint32_t deadline_ms )
+{
+#if defined(ARENA)
+  APP_LOG( APP_LOG_LEVEL_INFO
+         , "PROFILE arena %s %u bytes: peak used=%u, headroom=%u, spilled to the heap=%u"
+         , PROFILE_PLATFORM, (unsigned)Arena_size( ), (unsigned)Arena_peak( ), (unsigned)Arena_headroom( ), (unsigned)Arena_spilled( )
+         ) ;
+#endif
+
+  for (int stage = 0  ;  stage < PROFILE_STAGES  ;  ++stage)
+  {
+    const ProfileStageLog *log        = s_profile_stages + stage ;
+    const int              samplesNum = log->count < PROFILE_SAMPLES ? (int)log->count : PROFILE_SAMPLES ;
+
+    if (samplesNum == 0)
+      continue ;
+
+    // Sort a copy of the ring, for the min & p99.
+    uint16_t sorted[PROFILE_SAMPLES] ;
+    uint32_t sum          = 0 ;
+    int      overDeadline = 0 ;
+
+    for (int i = 0  ;  i < samplesNum  ;  ++i)
+    {
+      sorted[i] = log->samples[i] ;
+      sum      += sorted[i] ;
+
+      if (sorted[i] > deadline_ms)
+        ++overDeadline ;
+    }
+
+    Timing_sort( sorted, samplesNum ) ;
+
+    APP_LOG( APP_LOG_LEVEL_INFO
+           , "PROFILE %-14s last %3d: min=%u avg=%u p99=%u max=%u (ms), over %ums: %d, frames: %u"
+           , s_profile_stageNames[stage]
+           , samplesNum
+           , sorted[0]
+           , (unsigned)(sum / samplesNum)
+           , sorted[samplesNum * 99 / 100]
+           , sorted[samplesNum - 1]
+           , (unsigned)deadline_ms
+           , overDeadline
+           , (unsigned)log->count
+           ) ;
+  }
+}
+
+#endif
@@ -0,0 +1,50 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Profile.h
+
+   Last revision: 16 October 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include "Config.h"
+
+
+// Per stage timing ring buffer capacity, power of two.
+#define PROFILE_SAMPLES_LOG2    7
+#define PROFILE_SAMPLES         (1 << PROFILE_SAMPLES_LOG2)
+
+
+typedef enum { PROFILE_STAGE_ACCEL              // accel_data_service_handler( ) batch ingestion.
+             , PROFILE_STAGE_ANIMATION          // Clock3D_updateAnimation( ).
+             , PROFILE_STAGE_CAMERA             // Filtered viewPoint + cam_config( ).
+             , PROFILE_STAGE_DRAW_SOLID         // Clock3D_draw( ), per transparency mode.
+             , PROFILE_STAGE_DRAW_XRAY
+             , PROFILE_STAGE_DRAW_WIREFRAME
+             , PROFILE_STAGE_TIMER_TO_DRAW      // Update timer fired => world_draw( ) done.
+             , PROFILE_STAGES
+             }
+ProfileStage ;
+
+
+#if defined(PROFILE)
+
+  void  Profile_begin     ( ProfileStage stage ) ;
+  void  Profile_end       ( ProfileStage stage ) ;
+  void  Profile_report    ( uint32_t deadline_ms ) ;    // Logs min/avg/p99 and the count of samples over deadline_ms per stage, plus the arena peak & headroom.
+  void  Profile_heap      ( const char *label ) ;       // Logs the arena usage now.
+
+  #define PROFILE_BEGIN(stage)           Profile_begin( stage )
+  #define PROFILE_END(stage)             Profile_end( stage )
+  #define PROFILE_REPORT(deadline_ms)    Profile_report( deadline_ms )
+  #define PROFILE_HEAP(label)            Profile_heap( label )
+
+#else
+
+  #define PROFILE_BEGIN(stage)
+  #define PROFILE_END(stage)
+  #define PROFILE_REPORT(deadline_ms)
+  #define PROFILE_HEAP(label)
+
+#endif
@@ -0,0 +1,271 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Recorder.c
+
+   Last revision: 16 October 2026
+*/
+
+#include "Recorder.h"
+
+
+#if defined(RECORD)
+
+#define RECORDER_PAIR_FRAMES_MAX    63    // INPUT_ACCEL_PAIR arg bits 2-7.
+
+static
+bool
+recorder_fitsDelta
+( int32_t dx
+, int32_t dy
+, int32_t dz
+)
+{
+  return dx >= INT8_MIN  &&  dx <= INT8_MAX
+      && dy >= INT8_MIN  &&  dy <= INT8_MAX
+      && dz >= INT8_MIN  &&  dz <= INT8_MAX ;
+}
+
+
+static InputEvent  s_recorder_events[RECORDER_CAPACITY] ;
+static int         s_recorder_eventsNum   = 0 ;
+static uint32_t    s_recorder_lastFrame   = 0 ;
+static bool        s_recorder_overflowed  = false ;
+
+static int16_t     s_recorder_accelX, s_recorder_accelY, s_recorder_accelZ ;    // Last accel sample written.
+
+static bool        s_recorder_hasPending  = false ;    // Accel sample waiting for a second one to pair with.
+static InputEvent  s_recorder_pending ;
+static uint32_t    s_recorder_pendingFrame ;
+
+
+static
+void
+recorder_append
+( uint32_t   frame
+, InputType  type
+, uint8_t    arg
+, int16_t    x
+, int16_t    y
+, int16_t    z
+)
+{
+  const uint32_t frameDelta = frame - s_recorder_lastFrame ;    // A tick is recorded every second, fits 16 bits.
+
+  if (s_recorder_eventsNum >= RECORDER_CAPACITY)
+  {
+    s_recorder_overflowed = true ;    // Stop recording, a truncated log still replays fine.
+    return ;
+  }
+
+  s_recorder_events[s_recorder_eventsNum++] = (InputEvent){ .frameDelta = frameDelta, .type = type, .arg = arg, .x = x, .y = y, .z = z } ;
+  s_recorder_lastFrame = frame ;
+}
+
+
+static
+void
+recorder_accelWrite
+( uint32_t  frame
+, uint8_t   did_vibrate
+, int16_t   x
+, int16_t   y
+, int16_t   z
+)
+{
+  recorder_append( frame, INPUT_ACCEL, did_vibrate, x, y, z ) ;
+
+  s_recorder_accelX = x ;
+  s_recorder_accelY = y ;
+  s_recorder_accelZ = z ;
+}
+
+
+static
+void
+recorder_flush
+( )
+{ // A pending accel sample nobody paired with goes out on its own.
+  if (!s_recorder_hasPending)
+    return ;
+
+  s_recorder_hasPending = false ;
+  recorder_accelWrite( s_recorder_pendingFrame, s_recorder_pending.arg, s_recorder_pending.x, s_recorder_pending.y, s_recorder_pending.z ) ;
+}
+
+
+static
+void
+recorder_accel
+( uint32_t  frame
+, uint8_t   did_vibrate
+, int16_t   x
+, int16_t   y
+, int16_t   z
+)
+{
+  if (s_recorder_hasPending)
+  {
+    const InputEvent *p = &s_recorder_pending ;
+
+    if ( frame - s_recorder_pendingFrame <= RECORDER_PAIR_FRAMES_MAX
+      && recorder_fitsDelta( x - p->x, y - p->y, z - p->z )
+       )
+    {
+      const uint8_t dx1 = p->x - s_recorder_accelX, dy1 = p->y - s_recorder_accelY, dz1 = p->z - s_recorder_accelZ ;
+      const uint8_t dx2 = x - p->x                , dy2 = y - p->y                , dz2 = z - p->z ;
+
+      recorder_append( s_recorder_pendingFrame
+                     , INPUT_ACCEL_PAIR
+                     , (p->arg ? 1 : 0) | (did_vibrate ? 2 : 0) | (frame - s_recorder_pendingFrame) << 2
+                     , (int16_t)(dx1 | dx2 << 8)
+                     , (int16_t)(dy1 | dy2 << 8)
+                     , (int16_t)(dz1 | dz2 << 8)
+                     ) ;
+
+      s_recorder_hasPending = false ;
+      s_recorder_accelX     = x ;
+      s_recorder_accelY     = y ;
+      s_recorder_accelZ     = z ;
+      return ;
+    }
+
+    recorder_flush( ) ;
+  }
+
+  if (s_recorder_eventsNum > 0  &&  recorder_fitsDelta( x - s_recorder_accelX, y - s_recorder_accelY, z - s_recorder_accelZ ))
+  {
+    s_recorder_pending      = (InputEvent){ .type = INPUT_ACCEL, .arg = did_vibrate, .x = x, .y = y, .z = z } ;
+    s_recorder_pendingFrame = frame ;
+    s_recorder_hasPending   = true ;
+  }
+  else
+    recorder_accelWrite( frame, did_vibrate, x, y, z ) ;
+}
+
+
+void
+Recorder_record
+( uint32_t   frame
+, InputType  type
+, uint8_t    arg
+, int16_t    x
+, int16_t    y
+, int16_t    z
+)
+{
+  if (type == INPUT_ACCEL)
+  {
+    recorder_accel( frame, arg, x, y, z ) ;
+    return ;
+  }
+
+  recorder_flush( ) ;    // Keeps the log in frame order, pairs never straddle other events.
+  recorder_append( frame, type, arg, x, y, z ) ;
+}
+
+
+void
+Recorder_dump
+( )
+{
+  recorder_flush( ) ;
+
+  APP_LOG( APP_LOG_LEVEL_INFO, "RECORD %d events%s, ReplayLog.inc follows:", s_recorder_eventsNum, s_recorder_overflowed ? " (truncated)" : "" ) ;
+
+  for (int i = 0  ;  i < s_recorder_eventsNum  ;  ++i)
+  {
+    const InputEvent *event = s_recorder_events + i ;
+    APP_LOG( APP_LOG_LEVEL_INFO, "{ %u, %u, %u, %d, %d, %d },", event->frameDelta, event->type, event->arg, event->x, event->y, event->z ) ;
+  }
+}
+
+#endif
+
+
+#if defined(REPLAY)
+
+static const InputEvent s_replay_events[] =
+{
+  #include "ReplayLog.inc"
+} ;
+
+#define REPLAY_EVENTS_NUM   (int)(sizeof(s_replay_events) / sizeof(s_replay_events[0]))
+
+static int         s_replay_next      = 0 ;
+static uint32_t    s_replay_nextFrame = 0 ;    // Frame of s_replay_events[s_replay_next].
+
+static int16_t     s_replay_accelX, s_replay_accelY, s_replay_accelZ ;    // Last accel sample replayed.
+
+static InputEvent  s_replay_accel ;            // INPUT_ACCEL_PAIR first sample, as returned.
+static InputEvent  s_replay_second ;           // INPUT_ACCEL_PAIR second sample ...
+static bool        s_replay_hasSecond = false ;
+static uint32_t    s_replay_secondFrame ;      // ... and its frame.
+
+
+const InputEvent *
+Recorder_replayNext
+( uint32_t frame )
+{
+  if (s_replay_hasSecond)
+  { // Nothing was recorded between the two samples of a pair.
+    if (s_replay_secondFrame > frame)
+      return NULL ;
+
+    s_replay_hasSecond = false ;
+    return &s_replay_second ;
+  }
+
+  if (s_replay_next >= REPLAY_EVENTS_NUM)
+    return NULL ;
+
+  const InputEvent *event = s_replay_events + s_replay_next ;
+
+  if (s_replay_nextFrame + event->frameDelta > frame)
+    return NULL ;
+
+  s_replay_nextFrame += event->frameDelta ;
+  ++s_replay_next ;
+
+  switch (event->type)
+  {
+    case INPUT_ACCEL:
+      s_replay_accelX = event->x ;
+      s_replay_accelY = event->y ;
+      s_replay_accelZ = event->z ;
+      return event ;
+
+    case INPUT_ACCEL_PAIR:
+      s_replay_accel  = (InputEvent){ .type = INPUT_ACCEL
+                                    , .arg  = event->arg & 1
+                                    , .x    = s_replay_accelX + (int8_t)(event->x & 0xFF)
+                                    , .y    = s_replay_accelY + (int8_t)(event->y & 0xFF)
+                                    , .z    = s_replay_accelZ + (int8_t)(event->z & 0xFF)
+                                    } ;
+      s_replay_second = (InputEvent){ .type = INPUT_ACCEL
+                                    , .arg  = (event->arg >> 1) & 1
+                                    , .x    = s_replay_accel.x + (int8_t)((uint16_t)event->x >> 8)
+                                    , .y    = s_replay_accel.y + (int8_t)((uint16_t)event->y >> 8)
+                                    , .z    = s_replay_accel.z + (int8_t)((uint16_t)event->z >> 8)
+                                    } ;
+
+      s_replay_accelX      = s_replay_second.x ;
+      s_replay_accelY      = s_replay_second.y ;
+      s_replay_accelZ      = s_replay_second.z ;
+      s_replay_secondFrame = s_replay_nextFrame + (event->arg >> 2) ;
+      s_replay_hasSecond   = true ;
+      return &s_replay_accel ;
+
+    default:
+      return event ;
+  }
+}
+
+
+bool
+Recorder_replayDone
+( )
+{
+  return s_replay_next >= REPLAY_EVENTS_NUM  &&  !s_replay_hasSecond ;
+}
+
+#endif
@@ -0,0 +1,71 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Recorder.h
+
+   Last revision: 16 October 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+#include "Config.h"
+
+
+// RECORD capacity (events), 10 bytes each. DYNAMIC mode accel samples dominate: 25 per second, mostly
+// packed two per INPUT_ACCEL_PAIR event. With the SECOND_UNIT ticks that is ~14 events per second: ~2.5
+// minutes of DYNAMIC mode, ~34 minutes of STEADY mode (ticks only).
+#define RECORDER_CAPACITY    2048
+
+
+typedef enum { INPUT_TICK        // arg: units_changed, x: mday, y: hour * 60 + min, z: sec
+             , INPUT_TAP         // arg: axis, x: direction
+             , INPUT_BUTTON      // arg: InputButton
+             , INPUT_ACCEL       // arg: did_vibrate, x/y/z: sample
+             , INPUT_STEPS       // arg: animation steps of the next world update, recorded only when not 1
+             , INPUT_ACCEL_PAIR  // Two INPUT_ACCEL as int8_t deltas. arg: bit 0/1 did_vibrate of sample 1/2, bits 2-7 frames
+                                 // from sample 1 to 2. x/y/z: low byte sample 1 - previous sample, high byte sample 2 - sample 1.
+             }
+InputType ;
+
+
+typedef enum { INPUT_BUTTON_SPIN_INCREMENT
+             , INPUT_BUTTON_SPIN_DECREMENT
+             , INPUT_BUTTON_TRANSPARENCY_CHANGE
+             , INPUT_BUTTON_DISPLAYTYPE_CYCLE
+             , INPUT_BUTTON_CONFIGMODE_ENTER
+             , INPUT_BUTTON_CONFIGMODE_EXIT
+             }
+InputButton ;
+
+
+typedef struct
+{ uint16_t  frameDelta ;   // World updates since the previous event.
+  uint8_t   type ;         // InputType
+  uint8_t   arg ;
+  int16_t   x, y, z ;
+} InputEvent ;
+
+
+#if defined(RECORD)
+
+  void  Recorder_record( uint32_t frame, InputType type, uint8_t arg, int16_t x, int16_t y, int16_t z ) ;
+  void  Recorder_dump  ( ) ;
+
+  #define RECORD_INPUT(frame, type, arg, x, y, z)    Recorder_record( frame, type, arg, x, y, z )
+  #define RECORD_DUMP()                              Recorder_dump( )
+
+#else
+
+  #define RECORD_INPUT(frame, type, arg, x, y, z)
+  #define RECORD_DUMP()
+
+#endif
+
+
+#if defined(REPLAY)
+
+  // Next recorded event due at (or before) frame, NULL if none. INPUT_ACCEL_PAIR events come out as two INPUT_ACCEL.
+  const InputEvent *Recorder_replayNext( uint32_t frame ) ;
+  bool              Recorder_replayDone( ) ;
+
+#endif
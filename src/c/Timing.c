@@ -0,0 +1,40 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Timing.c
+
+   Last revision: 16 October 2026
+*/
+
+#include "Timing.h"
+
+
+uint32_t
+Timing_nowMs
+( )
+{
+  time_t   seconds ;
+  uint16_t milliseconds ;
+
+  time_ms( &seconds, &milliseconds ) ;
+
+  return (uint32_t)seconds * 1000 + milliseconds ;
+}
+
+
+void
+Timing_sort
+( uint16_t *samples
+, int       samplesNum
+)
+{
+  for (int i = 1  ;  i < samplesNum  ;  ++i)
+  {
+    const uint16_t sample = samples[i] ;
+    int            j      = i ;
+
+    for ( ; j > 0  &&  samples[j-1] > sample  ;  --j)
+      samples[j] = samples[j-1] ;
+
+    samples[j] = sample ;
+  }
+}
@@ -0,0 +1,24 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : Timing.h
+
+   Last revision: 16 October 2026
+*/
+
+#pragma once
+
+#include <pebble.h>
+
+
+// Wall clock milliseconds (wraps around every ~49 days: compare differences only).
+uint32_t
+Timing_nowMs
+( ) ;
+
+
+// Sorts duration samples (ms) in place, ascending: insertion sort, for the few hundred samples of a report.
+void
+Timing_sort
+( uint16_t *samples
+, int       samplesNum
+) ;
@@ -9,16 +9,28 @@
 #include <pebble.h>
 #include <karambola/FastMath.h>
 #include <karambola/R3.h>
-#include <karambola/Interpolator.h>
 #include <karambola/CamR3.h>
 #include <karambola/TransformR3.h>
-#include <karambola/Sampler.h>
 #include <karambola/Clock3D.h>
 
 #include "Config.h"
+#include "AccelFilter.h"
+#include "Profile.h"
+#include "Timing.h"
+#include "Arena.h"
+#include "HeapCheck.h"
+#include "Recorder.h"
+#include "Governor.h"
+#include "Gesture.h"
+#include "Interpolations.h"   // Generated by wscript: ANIMATION_FLIP_STEPS & flip interpolation tables.
+#include "Platform.h"         // Generated by wscript: per platform camera zoom & arena constants.
+
+#if defined(BENCH)
+  #include <karambola/Sampler.h>    // Baseline for the AccelFilter benchmark.
+#endif
 
 // Obstruction related.
-GSize available_screen ;
+GSize available_screen = { PBL_DISPLAY_WIDTH, PBL_DISPLAY_HEIGHT } ;    // Only differs while obstructed.
 
 
 // UI related
@@ -29,9 +41,18 @@ static ActionBarLayer *s_action_bar;
 
 
 // World related
-#define ACCEL_SAMPLER_CAPACITY    8
+#define ACCEL_FILTER_KERNEL       ACCELFILTER_KERNEL_BOXCAR
+#define ACCEL_STEADY_X            -81     // STEADY viewPoint attractor.
+#define ACCEL_STEADY_Y           -816
+#define ACCEL_STEADY_Z           -571
+#define ACCEL_SAMPLING_RATE       ACCEL_SAMPLING_25HZ
+#define ACCEL_SAMPLE_MS           40      // 1000 / 25Hz
+#define ACCEL_SAMPLES_PER_UPDATE  5       // Samples per accel_data_service_handler( ) call: 5 @ 25Hz => 5 wakeups/s.
+
+#define CLOCK_DIGITTYPES  3       // Digit2D types Clock3D_cycleDigitType( ) goes round, must match the karambola package.
 
 static Clock3D s_clock ;  // The main/only world object.
+static uint8_t s_clock_digitTypeCycles = 0 ;    // Clock3D_cycleDigitType( ) calls since Clock3D_config( DIGIT2D_CURVYSKIN ), modulo CLOCK_DIGITTYPES.
 
 typedef enum { WORLD_MODE_UNDEFINED
              , WORLD_MODE_DYNAMIC
@@ -40,59 +61,177 @@ typedef enum { WORLD_MODE_UNDEFINED
 WorldMode ;
 
 // Animation related
-#define ANIMATION_INTERVAL_MS     40
-#define ANIMATION_FLIP_STEPS      50
-#define ANIMATION_SPIN_STEPS      75
+#define ANIMATION_INTERVAL_MS        40
+#define ANIMATION_IDLE_INTERVAL_MS  500    // Nothing animating: just follow the minutes ink blinker phases.
+#define ANIMATION_STEPS_MAX          ANIMATION_FLIP_STEPS    // Catch up at most one whole flip per update, then resync.
 
 static int        s_world_updateCount       = 0 ;
 static WorldMode  s_world_mode              = WORLD_MODE_UNDEFINED ;
 static AppTimer  *s_world_updateTimer_ptr   = NULL ;
+static bool       s_world_isIdle            = false ;  // Update timer running at ANIMATION_IDLE_INTERVAL_MS.
+static bool       s_world_isDormant         = false ;  // No update timer, MINUTE_UNIT ticks, static frame. See world_dormant_enter( ).
+static bool       s_world_isUpdating        = false ;  // Inside world_update_timer_handler( ): it re-arms (or not) the timer itself.
+static bool       s_world_isDirty           = true ;   // Something visible changed since the last world_draw( ).
+static uint32_t   s_world_hundredths        = 0 ;      // Wall clock hundredths of second last marked dirty for.
+static int        s_flip_framesLeft         = 0 ;      // Frames until the current digits flip animation ends.
+static uint32_t   s_animation_ms            = 0 ;      // Wall clock time the animation has been advanced to.
+
+static AccelFilter  s_accelFilter ;           // Filtered gravity vector, the DYNAMIC mode viewPoint.
+static GestureRecognizer  s_gesture ;         // Punch/twist/shake over the DYNAMIC mode raw accel stream.
+
+#if defined(GOVERNOR)
+  static Governor   s_governor ;                // Battery & frame cost driven quality tier.
+  static uint32_t   s_governor_updateMs = 0 ;   // Cost of the last world_update( ), added to the draw cost.
+
+  #define ANIMATION_FRAME_MS          (Governor_tier( &s_governor )->interval_ms)
+  #define ANIMATION_HUNDREDTHS        (Governor_tier( &s_governor )->hundredths)
+  #define ANIMATION_TRANSPARENCY      (Governor_tier( &s_governor )->wireframe ? MESH_TRANSPARENCY_WIREFRAME : s_transparencyMode)
+#else
+  #define ANIMATION_FRAME_MS          ANIMATION_INTERVAL_MS
+  #define ANIMATION_HUNDREDTHS        true
+  #define ANIMATION_TRANSPARENCY      s_transparencyMode
+#endif
 
-Sampler   *sampler_accelX = NULL ;            // To be allocated at world_initialize( ).
-Sampler   *sampler_accelY = NULL ;            // To be allocated at world_initialize( ).
-Sampler   *sampler_accelZ = NULL ;            // To be allocated at world_initialize( ).
-
-float     *spinRotationFraction    = NULL ;   // To be allocated at world_initialize( ).
-float     *animRotationFraction    = NULL ;   // To be allocated at world_initialize( ).
-float     *animTranslationFraction = NULL ;   // To be allocated at world_initialize( ).
+// Read by Clock3D_updateAnimation( ), point at the const tables generated at build time.
+float     *animRotationFraction    = (float *)INTERPOLATION_ACCELERATE_DECELERATE ;
+float     *animTranslationFraction = (float *)INTERPOLATION_SIN_YOYO ;
 
 
 // Persistence related
 #define PKEY_WORLD_MODE            1
 #define PKEY_TRANSPARENCY_MODE     2
+#define PKEY_WORLD_SNAPSHOT        3          // WorldSnapshot, see world_snapshot_save( ).
 
 #define WORLD_MODE_DEFAULT         WORLD_MODE_DYNAMIC
 #define MESH_TRANSPARENCY_DEFAULT  MESH_TRANSPARENCY_SOLID
 
 
 // APP run mode related.
+#define BLINKER_CONFIGMODE_MS          250    // configMode_inkBlinker on & off lengths.
+#define BLINKER_CLOCK_MINUTES_MS       500    // clock_minutes_inkBlinker on & off lengths.
+
 Blinker   configMode_inkBlinker ;
 Blinker   clock_minutes_inkBlinker ;
 
+static uint32_t  s_blinker_configMode_ms    = 0 ;    // Wall clock time configMode_inkBlinker was started.
+static uint32_t  s_blinker_clockMinutes_ms  = 0 ;    // Wall clock time clock_minutes_inkBlinker was started.
+static uint32_t  s_blinker_phase            = 0 ;    // Phase of the showing blinker last marked dirty for.
+
 // User related
-#define USER_SECONDSINACTIVE_MAX       90
+#define USER_SECONDSINACTIVE_MAX       90     // Then go dormant until the next tap or button press.
 
 static uint8_t s_user_secondsInactive  = 0 ;
+static bool    s_user_configMode       = false ;
 
 
 // Spin(Z) CONSTANTS & variables
+#if defined(FIXED_POINT)
+// Binary angle: the whole uint32_t range is one revolution, wrap around does the angle normalization for free.
+typedef uint32_t  SpinRotation ;
+
+#define        SPIN_ROTATION_QUANTA   68357                     // 0.0001 rad as binary angle: 0.0001 / (2 * PI) * 2^32
+#define        SPIN_ROTATION_STEADY   ((SpinRotation)-(1 << 29))  // -45 degrees.
+#else
+typedef float     SpinRotation ;
+
 #define        SPIN_ROTATION_QUANTA   0.0001
 #define        SPIN_ROTATION_STEADY  -DEG_045
-#define        SPIN_SPEED_BUTTON_STEP 20
-#define        SPIN_SPEED_PUNCH_STEP  1000
+#endif
+
+#define        SPIN_SPEED_BUTTON_STEP      20
+#define        SPIN_SPEED_PUNCH_STEP     1000
+#define        SPIN_SPEED_PUNCH_STRENGTH 1500    // Punch strength (mG) worth one SPIN_SPEED_PUNCH_STEP.
 
-static int     s_spin_speed     = 0 ;                      // Initial spin speed.
-static float   s_spin_rotation  = SPIN_ROTATION_STEADY ;   // Initial spin rotation angle allows to view hours/minutes/seconds faces.
+static int           s_spin_speed     = 0 ;                      // Initial spin speed.
+static SpinRotation  s_spin_rotation  = SPIN_ROTATION_STEADY ;   // Initial spin rotation angle allows to view hours/minutes/seconds faces.
 
 
 // Camera related
 #define  CAM3D_DISTANCEFROMORIGIN    (2.2 * CUBE_SIZE)
+#define  CAM3D_VIEWPOINT_EPSILON     8       // mG (L1) the filtered viewPoint must move for a camera rebuild, ~0.5 degree.
+#define  CAM3D_SPINS_MAX            32       // Incremental spin rotations of the camera before a rebuild resyncs their float rounding.
 
 static CamR3             s_cam ;
-static float             s_cam_zoom           = PBL_IF_RECT_ELSE(1.25f, 1.15f) ;
+static bool              s_cam_isValid        = false ;    // s_cam was set up from the s_cam_viewPoint/s_cam_rotation below.
+static int32_t           s_cam_viewPointX, s_cam_viewPointY, s_cam_viewPointZ ;
+
+// The filtered viewPoint moves once per accel batch: the camera glides there over one batch period instead of
+// stepping 5 times per second, one batch behind.
+#define  CAM3D_GLIDE_STEPS           (ACCEL_SAMPLES_PER_UPDATE * ACCEL_SAMPLE_MS / ANIMATION_INTERVAL_MS)
+
+static bool              s_cam_glideIsSeeded  = false ;
+static int32_t           s_cam_glideFromX, s_cam_glideFromY, s_cam_glideFromZ ;
+static int32_t           s_cam_glideToX, s_cam_glideToY, s_cam_glideToZ ;          // Latest filter output.
+static uint8_t           s_cam_glideSteps ;                                      // Animation steps done from => to.
+static SpinRotation      s_cam_rotation ;
+static uint8_t           s_cam_spins          = 0 ;        // Incremental spin rotations of s_cam since it was last built.
+static float             s_cam_zoom           = PLATFORM_CAM_ZOOM ;
 static MeshTransparency  s_transparencyMode   = MESH_TRANSPARENCY_SOLID ;   // To be loaded/initialized from persistent storage.
 
 
+// Blinkers related
+static
+bool
+blinker_phaseChanged
+( )
+{ // The showing ink blinker (config mode or clock minutes) switched ink since the last call.
+  const uint32_t phase = s_user_configMode ? (Timing_nowMs( ) - s_blinker_configMode_ms   ) / BLINKER_CONFIGMODE_MS
+                                           : (Timing_nowMs( ) - s_blinker_clockMinutes_ms) / BLINKER_CLOCK_MINUTES_MS ;
+
+  if (phase == s_blinker_phase)
+    return false ;
+
+  s_blinker_phase = phase ;
+  return true ;
+}
+
+
+// Scheduling related
+static
+bool
+world_isAnimating
+( )
+{
+#if defined(BENCH)
+  return true ;                               // Benchmark measures every frame.
+#else
+  return s_world_mode == WORLD_MODE_DYNAMIC   // Accel driven camera, spin & hundredths digits.
+      || s_flip_framesLeft >  0
+      || s_user_configMode ;                  // Config mode ink blinker is faster than ANIMATION_IDLE_INTERVAL_MS.
+#endif
+}
+
+
+// Forward declare.
+void  world_dormant_exit( ) ;
+
+static
+void
+world_wake
+( )
+{ // Back to full frame rate without waiting for the idle interval to expire.
+  if (s_world_isDormant)
+    world_dormant_exit( ) ;
+  else if (s_world_isIdle)
+  {
+    s_world_isIdle = false ;
+    s_animation_ms = Timing_nowMs( ) ;    // Nothing moved while idle, no steps to catch up.
+    app_timer_reschedule( s_world_updateTimer_ptr, ANIMATION_FRAME_MS ) ;
+  }
+}
+
+
+static
+void
+user_interaction
+( )
+{
+  s_user_secondsInactive = 0 ;
+  s_world_isDirty        = true ;
+  world_wake( ) ;
+}
+
+
 // Button click handlers
 void
 spinSpeed_increment_click_handler
@@ -100,7 +239,8 @@ spinSpeed_increment_click_handler
 , void              *context
 )
 {
-  s_user_secondsInactive = 0 ;
+  RECORD_INPUT( s_world_updateCount, INPUT_BUTTON, INPUT_BUTTON_SPIN_INCREMENT, 0, 0, 0 ) ;
+  user_interaction( ) ;
   s_spin_speed += SPIN_SPEED_BUTTON_STEP ;
 }
 
@@ -111,7 +251,8 @@ spinSpeed_decrement_click_handler
 , void              *context
 )
 {
-  s_user_secondsInactive = 0 ;
+  RECORD_INPUT( s_world_updateCount, INPUT_BUTTON, INPUT_BUTTON_SPIN_DECREMENT, 0, 0, 0 ) ;
+  user_interaction( ) ;
   s_spin_speed -= SPIN_SPEED_BUTTON_STEP ;
 }
 
@@ -122,7 +263,8 @@ transparencyMode_change_click_handler
 , void              *context
 )
 {
-  s_user_secondsInactive = 0 ;
+  RECORD_INPUT( s_world_updateCount, INPUT_BUTTON, INPUT_BUTTON_TRANSPARENCY_CHANGE, 0, 0, 0 ) ;
+  user_interaction( ) ;
 
   // Cycle trough the transparency modes.
   switch (s_transparencyMode)
@@ -149,8 +291,12 @@ displayType_cycle_click_handler
 , void              *context
 )
 {
-  s_user_secondsInactive = 0 ;
+  RECORD_INPUT( s_world_updateCount, INPUT_BUTTON, INPUT_BUTTON_DISPLAYTYPE_CYCLE, 0, 0, 0 ) ;
+  user_interaction( ) ;
+  ARENA_OPEN( ) ;    // The new digit meshes reuse the arena blocks the old ones free.
   Clock3D_cycleDigitType( &s_clock ) ;
+  ARENA_CLOSE( ) ;
+  s_clock_digitTypeCycles = (s_clock_digitTypeCycles + 1) % CLOCK_DIGITTYPES ;    // Buttons auto repeat: would wrap at 256.
 }
 
 
@@ -164,7 +310,10 @@ configMode_enter_click_handler
 , void              *context
 )
 {
-  s_user_secondsInactive = 0 ;
+  RECORD_INPUT( s_world_updateCount, INPUT_BUTTON, INPUT_BUTTON_CONFIGMODE_ENTER, 0, 0, 0 ) ;
+  user_interaction( ) ;
+  s_user_configMode       = true ;
+  s_blinker_configMode_ms = Timing_nowMs( ) ;
 
   s_clock.days_leftDigitA          ->mesh->inkBlinker
   = s_clock.days_leftDigitB        ->mesh->inkBlinker
@@ -183,8 +332,8 @@ configMode_enter_click_handler
   = s_clock.second100ths_leftDigit ->mesh->inkBlinker
   = s_clock.second100ths_rightDigit->mesh->inkBlinker
   = Blinker_start( &configMode_inkBlinker
-                 , 250      // lengthOn (ms)
-                 , 250      // lengthOff (ms)
+                 , BLINKER_CONFIGMODE_MS    // lengthOn (ms)
+                 , BLINKER_CONFIGMODE_MS    // lengthOff (ms)
                  , INK100   // inkOn (100%)
                  , INK0     // inkOff  (0%)
                  )
@@ -194,13 +343,12 @@ configMode_enter_click_handler
 }
 
 
+static
 void
-configMode_exit_click_handler
-( ClickRecognizerRef recognizer
-, void              *context
-)
-{
-  s_user_secondsInactive = 0 ;
+configMode_exit
+( )
+{ // Back to the normal mode ink blinkers & buttons.
+  s_user_configMode = false ;
 
   s_clock.days_leftDigitA          ->mesh->inkBlinker
   = s_clock.days_leftDigitB        ->mesh->inkBlinker
@@ -229,6 +377,18 @@ configMode_exit_click_handler
 }
 
 
+void
+configMode_exit_click_handler
+( ClickRecognizerRef recognizer
+, void              *context
+)
+{
+  RECORD_INPUT( s_world_updateCount, INPUT_BUTTON, INPUT_BUTTON_CONFIGMODE_EXIT, 0, 0, 0 ) ;
+  user_interaction( ) ;
+  configMode_exit( ) ;
+}
+
+
 void
 configMode_click_config_provider
 ( void *context )
@@ -278,32 +438,25 @@ normalMode_click_config_provider
 
 
 // Acellerometer handlers.
+static
 void
-accel_data_service_handler
-( AccelData *data
-, uint32_t   num_samples
-)
-{ }
-
-
-void
-accel_tap_service_handler
-( AccelAxisType  axis        // Process tap on ACCEL_AXIS_X, ACCEL_AXIS_Y or ACCEL_AXIS_Z
-, int32_t        direction   // Direction is 1 or -1
+gesture_apply
+( GestureType  gesture
+, int16_t      strength     // Spike peak (mG), scales the punch spin impulse.
 )
 {
-  s_user_secondsInactive = 0 ;      // Tap event qualifies as active user interaction.
-
   // Forward declaration
   void set_world_mode( uint8_t worldMode ) ;
 
-  switch ( axis )
+  user_interaction( ) ;      // Gestures qualify as active user interaction.
+
+  switch ( gesture )
   {
-    case ACCEL_AXIS_X:    // Punch: stop/launch spinning motion.
-      s_spin_speed += SPIN_SPEED_PUNCH_STEP ;       // Spin faster.
+    case GESTURE_PUNCH:   // Punch: stop/launch spinning motion.
+      s_spin_speed += SPIN_SPEED_PUNCH_STEP * strength / SPIN_SPEED_PUNCH_STRENGTH ;   // Spin faster, the harder the punch.
       break ;
 
-    case ACCEL_AXIS_Y:    // Twist: change the world mode.
+    case GESTURE_TWIST:   // Twist: change the world mode.
       switch( s_world_mode )
       { 
          case WORLD_MODE_STEADY:
@@ -321,18 +474,101 @@ accel_tap_service_handler
 
       break ;
 
-    case ACCEL_AXIS_Z:    // Ykes: stop spinning, bring to default spin rotation angle.
-    default:
+    case GESTURE_SHAKE:   // Ykes: stop spinning, bring to default spin rotation angle.
       s_spin_speed    = 0 ;                         // Stop spinning motion.
       s_spin_rotation = SPIN_ROTATION_STEADY ;      // Spin rotation angle that allows to view days/hours/minutes faces.
       break ;
+
+    case GESTURE_NONE:
+    default:
+      break ;
+  }
+}
+
+
+void
+accel_data_service_handler
+( AccelData *data
+, uint32_t   num_samples
+)
+{ // Called on the app event loop, same as world_update( ): the filter needs no locking.
+  PROFILE_BEGIN( PROFILE_STAGE_ACCEL ) ;
+  HEAP_CHECK_FRAME_BEGIN( s_world_updateCount ) ;
+
+  const WorldMode worldMode = s_world_mode ;
+
+  for (uint32_t i = 0  ;  i < num_samples  ;  ++i)
+  {
+    const AccelData *ad = data + i ;
+
+    RECORD_INPUT( s_world_updateCount, INPUT_ACCEL, ad->did_vibrate, ad->x, ad->y, ad->z ) ;
+
+    if (ad->did_vibrate)                                 // Vibration motor noise, not a viewPoint.
+      continue ;
+
+#if defined(QEMU)
+    if (ad->x == 0  &&  ad->y == 0  &&  ad->z == -1000)   // Under QEMU with SENSORS off this is the default output.
+    {
+      AccelFilter_push( &s_accelFilter, ACCEL_STEADY_X, ACCEL_STEADY_Y, ACCEL_STEADY_Z ) ;
+      continue ;
+    }
+#endif
+
+    AccelFilter_push( &s_accelFilter, ad->x, ad->y, ad->z ) ;
+
+    int16_t           strength ;
+    const GestureType gesture = GestureRecognizer_push( &s_gesture, ad->x, ad->y, ad->z, &strength ) ;
+
+    if (gesture != GESTURE_NONE)
+    {
+      gesture_apply( gesture, strength ) ;
+
+      if (s_world_mode != worldMode)    // Twist: the accel service was unsubscribed, the rest of the batch is stale.
+        break ;
+    }
+  }
+
+  HEAP_CHECK_FRAME_END( ) ;
+  PROFILE_END( PROFILE_STAGE_ACCEL ) ;
+}
+
+
+void
+accel_tap_service_handler
+( AccelAxisType  axis        // Process tap on ACCEL_AXIS_X, ACCEL_AXIS_Y or ACCEL_AXIS_Z
+, int32_t        direction   // Direction is 1 or -1
+)
+{
+  RECORD_INPUT( s_world_updateCount, INPUT_TAP, axis, direction, 0, 0 ) ;
+
+#if !defined(QEMU)    // Emulator taps do not show in its accel stream.
+  if (s_world_mode == WORLD_MODE_DYNAMIC)
+  { // The accel stream is subscribed: GestureRecognizer saw the same motion, with its strength (a Z tap as a shake).
+    user_interaction( ) ;
+    return ;
   }
+#endif
+
+  // Firmware taps only give an axis: nominal strength.
+  gesture_apply( axis == ACCEL_AXIS_X ? GESTURE_PUNCH : axis == ACCEL_AXIS_Y ? GESTURE_TWIST : GESTURE_SHAKE
+               , SPIN_SPEED_PUNCH_STRENGTH
+               ) ;
+}
+
+
+#if defined(GOVERNOR)
+void
+battery_state_service_handler
+( BatteryChargeState state )
+{
+  if (Governor_battery( &s_governor, state ))
+    s_world_isDirty = true ;    // Next frame at the new tier quality.
 }
+#endif
 
 
 // Forward declare.
-void  world_stop( ) ;
-void  world_finalize( ) ;
+void  world_dormant_enter( ) ;
 
 
 static
@@ -342,16 +578,7 @@ tick_timer_service_handler
 , TimeUnits  units_changed
 )
 {
-  if (s_spin_speed == 0)
-    ++s_user_secondsInactive ;
-
-  // Auto-exit application on lack of user interaction.
-  if (s_user_secondsInactive > USER_SECONDSINACTIVE_MAX)
-  {
-    world_stop( ) ;
-    world_finalize( ) ;
-    window_stack_pop_all( true )	;    // Exit app.
-  }
+  RECORD_INPUT( s_world_updateCount, INPUT_TICK, units_changed, tick_time->tm_mday, tick_time->tm_hour * 60 + tick_time->tm_min, tick_time->tm_sec ) ;
 
   Clock3D_setTime_DDHHMMSS( &s_clock
                           , tick_time->tm_mday   // days
@@ -359,8 +586,119 @@ tick_timer_service_handler
                           , tick_time->tm_min    // minutes
                           , tick_time->tm_sec    // seconds
                           ) ;
+
+  s_world_isDirty = true ;
+
+  if (s_world_isDormant)
+  { // No animation timer: land the flip right away and draw a single frame.
+    for (int step = 0  ;  step < ANIMATION_FLIP_STEPS  ;  ++step)
+      Clock3D_updateAnimation( &s_clock, ANIMATION_FLIP_STEPS ) ;
+
+    layer_mark_dirty( s_world_layer ) ;
+    return ;
+  }
+
+  if (s_spin_speed == 0)
+    ++s_user_secondsInactive ;
+
+  // Go dormant on lack of user interaction.
+  if (s_user_secondsInactive > USER_SECONDSINACTIVE_MAX)
+  {
+    world_dormant_enter( ) ;
+    return ;
+  }
+
+  if (units_changed & MINUTE_UNIT)    // Minutes/hours/days digits flip.
+  {
+    s_flip_framesLeft = ANIMATION_FLIP_STEPS ;
+    world_wake( ) ;
+  }
+  else if (s_world_isIdle)
+  { // Show the new seconds now, next idle update half way to the next tick.
+    layer_mark_dirty( s_world_layer ) ;
+    app_timer_reschedule( s_world_updateTimer_ptr, ANIMATION_IDLE_INTERVAL_MS ) ;
+  }
+}
+
+
+#if defined(FIXED_POINT) || defined(BENCH)    // BENCH checks it against the float path, on every platform.
+
+#define  CAM3D_DISTANCEFROMORIGIN_Q16    ((int32_t)(CAM3D_DISTANCEFROMORIGIN * 65536))
+
+static
+uint32_t
+isqrt
+( uint32_t n )
+{ // Bitwise integer square root.
+  uint32_t root = 0 ;
+  uint32_t bit  = 1u << 30 ;
+
+  while (bit > n)
+    bit >>= 2 ;
+
+  for ( ; bit != 0  ;  bit >>= 2)
+    if (n >= root + bit)
+    {
+      n   -= root + bit ;
+      root = (root >> 1) + bit ;
+    }
+    else
+      root >>= 1 ;
+
+  return root ;
+}
+
+
+static
+void
+cam_viewPoint_fixed
+( R3             *rotatedVP
+, const int32_t   pViewPointX    // Raw accel units (mG).
+, const int32_t   pViewPointY
+, const int32_t   pViewPointZ
+, const uint32_t  pRotZ          // Binary angle.
+)
+{ // Integer only equivalent of R3_scaTo( ) + R3_rotZrad( ): rotate first (keeps length), then scale to CAM3D_DISTANCEFROMORIGIN.
+  const int32_t sinZ    = sin_lookup( pRotZ >> 16 ) ;    // Binary angle to TRIG_MAX_ANGLE units.
+  const int32_t cosZ    = cos_lookup( pRotZ >> 16 ) ;
+  const int32_t rotX    = (pViewPointX * cosZ - pViewPointY * sinZ) / TRIG_MAX_RATIO ;
+  const int32_t rotY    = (pViewPointX * sinZ + pViewPointY * cosZ) / TRIG_MAX_RATIO ;
+  uint32_t      length  = isqrt( rotX * rotX + rotY * rotY + pViewPointZ * pViewPointZ ) ;
+
+  if (length == 0)
+    length = 1 ;
+
+  // One 32 bit divide: CAM3D_DISTANCEFROMORIGIN / length in Q32, then 32x64 bit multiplies (no __aeabi_ldivmod).
+  const int64_t scale = (int64_t)(UINT32_MAX / length) * CAM3D_DISTANCEFROMORIGIN_Q16 >> 16 ;
+
+  // Q16.16 => float only at the CamR3 interface.
+  *rotatedVP = (R3){ .x = (float)(int32_t)(rotX        * scale >> 16) * (1.0f / 65536)
+                   , .y = (float)(int32_t)(rotY        * scale >> 16) * (1.0f / 65536)
+                   , .z = (float)(int32_t)(pViewPointZ * scale >> 16) * (1.0f / 65536)
+                   } ;
+}
+
+#endif
+
+
+#if defined(FIXED_POINT)
+
+void
+cam_config
+( const int32_t       pViewPointX    // Raw accel units (mG).
+, const int32_t       pViewPointY
+, const int32_t       pViewPointZ
+, const SpinRotation  pRotZ
+)
+{
+  R3 rotatedVP ;
+  cam_viewPoint_fixed( &rotatedVP, pViewPointX, pViewPointY, pViewPointZ, pRotZ ) ;
+
+  // setup 3D camera
+  CamR3_lookAtOriginUpwards( &s_cam, &rotatedVP, s_cam_zoom, CAM_PROJECTION_PERSPECTIVE ) ;
 }
 
+#else
 
 void
 cam_config
@@ -378,6 +716,40 @@ cam_config
   CamR3_lookAtOriginUpwards( &s_cam, &rotatedVP, s_cam_zoom, CAM_PROJECTION_PERSPECTIVE ) ;
 }
 
+#endif
+
+
+static
+void
+cam_rotZ
+( R3          *v
+, const float  sinZ
+, const float  cosZ
+)
+{
+  const float x = v->x ;
+
+  v->x = x * cosZ - v->y * sinZ ;
+  v->y = x * sinZ + v->y * cosZ ;
+}
+
+
+void
+cam_spin
+( const int32_t angle )    // TRIG_MAX_ANGLE units.
+{ // The camera looks at the origin with Z upwards, both unchanged by a Z rotation: rotating the built camera
+  // (viewPoint and basis) is the same as rebuilding it from the rotated viewPoint, a dozen multiply-adds.
+  // This relies on the karambola CamR3 layout (as WorldSnapshot does): CamR3_lookAtOriginUpwards( ) derives only
+  // viewPoint, u, v & w from the viewPoint direction, its other fields stay valid. BENCH checks it against a rebuild.
+  const float sinZ = (float)sin_lookup( angle ) / TRIG_MAX_RATIO ;
+  const float cosZ = (float)cos_lookup( angle ) / TRIG_MAX_RATIO ;
+
+  cam_rotZ( &s_cam.viewPoint, sinZ, cosZ ) ;
+  cam_rotZ( &s_cam.u        , sinZ, cosZ ) ;
+  cam_rotZ( &s_cam.v        , sinZ, cosZ ) ;
+  cam_rotZ( &s_cam.w        , sinZ, cosZ ) ;
+}
+
 
 void
 set_world_mode
@@ -395,6 +767,8 @@ set_world_mode
       break ;
   }
 
+  s_world_isDirty = true ;
+
   // Start-up entering mode. Subscribe to newly needed services. Apply relevant configurations.
   switch ( s_world_mode = pWorldMode )
   {
@@ -404,7 +778,10 @@ set_world_mode
       break ;
 
     case WORLD_MODE_DYNAMIC:
-    	accel_data_service_subscribe( 0, accel_data_service_handler ) ;
+#if !defined(REPLAY)    // Replayed from the log.
+    	accel_data_service_subscribe( ACCEL_SAMPLES_PER_UPDATE, accel_data_service_handler ) ;
+      accel_service_set_sampling_rate( ACCEL_SAMPLING_RATE ) ;
+#endif
       break ;
 
     case WORLD_MODE_UNDEFINED:
@@ -414,42 +791,118 @@ set_world_mode
 }
 
 
-static
-void
-interpolations_initialize
-( )
-{
-  Interpolator_AccelerateDecelerate( spinRotationFraction = malloc((ANIMATION_SPIN_STEPS+1)*sizeof(float))
-                                   , ANIMATION_SPIN_STEPS
-                                   ) ;
+// Warm resume: everything needed to continue on the first frame exactly where the last run left off.
+#if !defined(BENCH) && !defined(REPLAY)    // Those need a reproducible cold start.
+  #define WORLD_SNAPSHOT
+#endif
+
+#if defined(WORLD_SNAPSHOT)
+
+#define WORLD_SNAPSHOT_VERSION     2          // 2: digitTypeCycles modulo CLOCK_DIGITTYPES.
+
+typedef struct
+{ uint16_t      checksum ;           // Of all the bytes after it.
+  uint8_t       format ;             // WORLD_SNAPSHOT_VERSION and SpinRotation flavour, see WORLD_SNAPSHOT_FORMAT.
+  uint8_t       digitTypeCycles ;
+  int32_t       spinSpeed ;
+  SpinRotation  spinRotation ;
+  AccelFilter   accelFilter ;
+  CamR3         cam ;                // Camera basis, plus the inputs it was built from.
+  SpinRotation  camRotation ;
+  int32_t       camViewPointX, camViewPointY, camViewPointZ ;
+} WorldSnapshot ;
+
+#if defined(FIXED_POINT)
+  #define WORLD_SNAPSHOT_FORMAT    (WORLD_SNAPSHOT_VERSION << 1 | 1)
+#else
+  #define WORLD_SNAPSHOT_FORMAT    (WORLD_SNAPSHOT_VERSION << 1 | 0)
+#endif
+
+_Static_assert( sizeof(WorldSnapshot) <= PERSIST_DATA_MAX_LENGTH, "WorldSnapshot must fit a single persist_write_data( )." ) ;
+
 
-  Interpolator_AccelerateDecelerate( animRotationFraction = malloc((ANIMATION_FLIP_STEPS+1)*sizeof(float))
-                                   , ANIMATION_FLIP_STEPS
-                                   ) ;
+static
+uint16_t
+world_snapshot_checksum
+( const WorldSnapshot *snapshot )
+{ // Fletcher-16 of the bytes after the checksum field.
+  const uint8_t *bytes = (const uint8_t *)snapshot + sizeof(snapshot->checksum) ;
+  uint16_t       sum1  = 0 ;
+  uint16_t       sum2  = 0 ;
+
+  for (size_t i = 0  ;  i < sizeof(WorldSnapshot) - sizeof(snapshot->checksum)  ;  ++i)
+  {
+    sum1 = (sum1 + bytes[i]) % 255 ;
+    sum2 = (sum2 + sum1    ) % 255 ;
+  }
 
-  Interpolator_SinYoYo( animTranslationFraction = malloc((ANIMATION_FLIP_STEPS+1)*sizeof(float))
-                      , ANIMATION_FLIP_STEPS
-                      ) ;
+  return sum2 << 8 | sum1 ;
 }
 
 
 static
 void
-sampler_initialize
+world_snapshot_save
 ( )
 {
-  sampler_accelX = Sampler_new( ACCEL_SAMPLER_CAPACITY ) ;
-  sampler_accelY = Sampler_new( ACCEL_SAMPLER_CAPACITY ) ;
-  sampler_accelZ = Sampler_new( ACCEL_SAMPLER_CAPACITY ) ;
+  WorldSnapshot snapshot ;
+  memset( &snapshot, 0, sizeof(snapshot) ) ;    // Deterministic padding bytes, for the checksum.
+
+  snapshot.format          = WORLD_SNAPSHOT_FORMAT ;
+  snapshot.digitTypeCycles = s_clock_digitTypeCycles ;
+  snapshot.spinSpeed       = s_spin_speed ;
+  snapshot.spinRotation    = s_spin_rotation ;
+  snapshot.accelFilter     = s_accelFilter ;
+  snapshot.cam             = s_cam ;
+  snapshot.camRotation     = s_cam_rotation ;
+  snapshot.camViewPointX   = s_cam_viewPointX ;
+  snapshot.camViewPointY   = s_cam_viewPointY ;
+  snapshot.camViewPointZ   = s_cam_viewPointZ ;
+  snapshot.checksum        = world_snapshot_checksum( &snapshot ) ;
+
+  if (s_cam_isValid)
+    persist_write_data( PKEY_WORLD_SNAPSHOT, &snapshot, sizeof(snapshot) ) ;
+  else
+    persist_delete( PKEY_WORLD_SNAPSHOT ) ;      // Never ran in DYNAMIC mode: nothing worth resuming.
+}
 
-  for ( int i = 0  ;  i < ACCEL_SAMPLER_CAPACITY  ;  ++i )
+
+static
+void
+world_snapshot_load
+( )
+{ // Called after Clock3D_config( ) and AccelFilter_initialize( ), overrides their defaults if the snapshot is valid.
+  WorldSnapshot snapshot ;
+
+  if ( persist_get_size( PKEY_WORLD_SNAPSHOT ) != (int)sizeof(snapshot)
+    || persist_read_data( PKEY_WORLD_SNAPSHOT, &snapshot, sizeof(snapshot) ) != (int)sizeof(snapshot)
+    || snapshot.format   != WORLD_SNAPSHOT_FORMAT
+    || snapshot.checksum != world_snapshot_checksum( &snapshot )
+    || snapshot.accelFilter.kernel != ACCEL_FILTER_KERNEL
+    || snapshot.digitTypeCycles    >= CLOCK_DIGITTYPES
+     )
   {
-    Sampler_push( sampler_accelX,  -81 ) ;   // STEADY viewPoint attractor.
-    Sampler_push( sampler_accelY, -816 ) ;   // STEADY viewPoint attractor.
-    Sampler_push( sampler_accelZ, -571 ) ;   // STEADY viewPoint attractor.
+    LOGW( "world_snapshot_load:: no valid snapshot, cold start." ) ;
+    return ;
   }
+
+  // At most CLOCK_DIGITTYPES - 1 mesh rebuilds.
+  for (s_clock_digitTypeCycles = 0  ;  s_clock_digitTypeCycles < snapshot.digitTypeCycles  ;  ++s_clock_digitTypeCycles)
+    Clock3D_cycleDigitType( &s_clock ) ;
+
+  s_spin_speed     = snapshot.spinSpeed ;
+  s_spin_rotation  = snapshot.spinRotation ;
+  s_accelFilter    = snapshot.accelFilter ;
+  s_cam            = snapshot.cam ;
+  s_cam_rotation   = snapshot.camRotation ;
+  s_cam_viewPointX = snapshot.camViewPointX ;
+  s_cam_viewPointY = snapshot.camViewPointY ;
+  s_cam_viewPointZ = snapshot.camViewPointZ ;
+  s_cam_isValid    = true ;
 }
 
+#endif
+
 
 void
 world_initialize
@@ -467,98 +920,675 @@ world_initialize
   = &clock_minutes_inkBlinker
   ;
 
-  sampler_initialize( ) ;
-  interpolations_initialize( ) ;
+  AccelFilter_initialize( &s_accelFilter, ACCEL_FILTER_KERNEL, ACCEL_STEADY_X, ACCEL_STEADY_Y, ACCEL_STEADY_Z ) ;
+  GestureRecognizer_initialize( &s_gesture, ACCEL_STEADY_X, ACCEL_STEADY_Y, ACCEL_STEADY_Z ) ;
+
+#if defined(GOVERNOR)
+  Governor_initialize( &s_governor ) ;
+#endif
   Clock3D_config( &s_clock, DIGIT2D_CURVYSKIN ) ;
+
+#if defined(WORLD_SNAPSHOT)
+  world_snapshot_load( ) ;
+#endif
 }
 
 
 // UPDATE CAMERA & WORLD OBJECTS PROPERTIES
 
+#if defined(REPLAY)
+static int  s_replay_steps = 1 ;    // Animation steps of the next world_update( ), set by replay_feed( ).
+#endif
+
 static
 void
-world_update
-( )
+cam_glide_get
+( int32_t *x
+, int32_t *y
+, int32_t *z
+)
 {
-  ++s_world_updateCount ;
+  *x = s_cam_glideFromX + (s_cam_glideToX - s_cam_glideFromX) * s_cam_glideSteps / CAM3D_GLIDE_STEPS ;
+  *y = s_cam_glideFromY + (s_cam_glideToY - s_cam_glideFromY) * s_cam_glideSteps / CAM3D_GLIDE_STEPS ;
+  *z = s_cam_glideFromZ + (s_cam_glideToZ - s_cam_glideFromZ) * s_cam_glideSteps / CAM3D_GLIDE_STEPS ;
+}
 
-  Clock3D_updateAnimation( &s_clock, ANIMATION_FLIP_STEPS ) ;
 
-  if (s_world_mode != WORLD_MODE_STEADY)
+static
+void
+cam_glide_viewPoint
+( int32_t *x
+, int32_t *y
+, int32_t *z
+)
+{ // Glided viewPoint for this update, restarts the glide from where it is when a new accel batch came in.
+  int32_t filterX, filterY, filterZ ;
+  AccelFilter_get( &s_accelFilter, &filterX, &filterY, &filterZ ) ;
+
+  if (!s_cam_glideIsSeeded)    // First update: no glide.
   {
-    Clock3D_second100ths_update( &s_clock ) ;
+    s_cam_glideFromX    = s_cam_glideToX = filterX ;
+    s_cam_glideFromY    = s_cam_glideToY = filterY ;
+    s_cam_glideFromZ    = s_cam_glideToZ = filterZ ;
+    s_cam_glideSteps    = CAM3D_GLIDE_STEPS ;
+    s_cam_glideIsSeeded = true ;
+  }
+  else if (filterX != s_cam_glideToX  ||  filterY != s_cam_glideToY  ||  filterZ != s_cam_glideToZ)
+  {
+    cam_glide_get( &s_cam_glideFromX, &s_cam_glideFromY, &s_cam_glideFromZ ) ;
+    s_cam_glideToX   = filterX ;
+    s_cam_glideToY   = filterY ;
+    s_cam_glideToZ   = filterZ ;
+    s_cam_glideSteps = 0 ;
+  }
 
-    AccelData ad ;
+  cam_glide_get( x, y, z ) ;
+}
 
-    if (accel_service_peek( &ad ) < 0)         // Accel service not available.
-    {
-      Sampler_push( sampler_accelX,  -81 ) ;   // STEADY viewPoint attractor.
-      Sampler_push( sampler_accelY, -816 ) ;   // STEADY viewPoint attractor.
-      Sampler_push( sampler_accelZ, -571 ) ;   // STEADY viewPoint attractor.
-    }
-    else
-    {
-#if defined(QEMU)
-      if (ad.x == 0  &&  ad.y == 0  &&  ad.z == -1000)   // Under QEMU with SENSORS off this is the default output.
-      {
-        Sampler_push( sampler_accelX,  -81 ) ;
-        Sampler_push( sampler_accelY, -816 ) ;
-        Sampler_push( sampler_accelZ, -571 ) ;
-      }
-      else                                               // If running under QEMU the SENSOR feed must be ON.
-      {
-        Sampler_push( sampler_accelX, ad.x ) ;
-        Sampler_push( sampler_accelY, ad.y ) ;
-        Sampler_push( sampler_accelZ, ad.z ) ;
-      }
-#else
-      Sampler_push( sampler_accelX, ad.x ) ;
-      Sampler_push( sampler_accelY, ad.y ) ;
-      Sampler_push( sampler_accelZ, ad.z ) ;
-#endif
-    }
-   
-    float cam_rotation ;
 
-    switch (s_world_mode)
+static
+int
+world_update_steps
+( )
+{ // Animation steps (of ANIMATION_INTERVAL_MS) due since the last update: a late timer or an overrun draw
+  // skips frames instead of slowing the animation down, so flips & spin stay on wall clock time.
+#if defined(REPLAY)
+  // Replay is frame exact, not wall clock based: the recorded step count, if any was fed for this update.
+  const int steps = s_replay_steps ;
+
+  s_replay_steps = 1 ;
+  return steps ;
+#else
+  const uint32_t now   = Timing_nowMs( ) ;
+  int            steps = (now - s_animation_ms + ANIMATION_INTERVAL_MS / 2) / ANIMATION_INTERVAL_MS ;
+
+  if (s_world_isIdle  ||  steps > ANIMATION_STEPS_MAX)  // Nothing was moving (or too far behind): resync.
+  {
+    s_animation_ms = now ;
+    return 1 ;
+  }
+
+  s_animation_ms += steps * ANIMATION_INTERVAL_MS ;
+
+#if defined(RECORD)
+  // Recorded along the inputs that preceded this update (s_world_updateCount was already incremented).
+  if (steps != 1)
+    RECORD_INPUT( s_world_updateCount - 1, INPUT_STEPS, steps, 0, 0, 0 ) ;
+#endif
+
+  return steps ;
+#endif
+}
+
+
+static
+void
+world_update
+( )
+{
+  ++s_world_updateCount ;
+
+  PROFILE_BEGIN( PROFILE_STAGE_ANIMATION ) ;
+
+  for (int steps = world_update_steps( )  ;  steps > 0  ;  --steps)
+  {
+    if (s_flip_framesLeft > 0)
     {
-      case WORLD_MODE_DYNAMIC:
-        // Friction: gradualy decrease spin speed until it stops.
-        if (s_spin_speed > 0)
-          --s_spin_speed ;
+      --s_flip_framesLeft ;
+      s_world_isDirty = true ;
+    }
 
-        if (s_spin_speed < 0)
-          ++s_spin_speed ;
+    Clock3D_updateAnimation( &s_clock, ANIMATION_FLIP_STEPS ) ;
 
-        if (s_spin_speed != 0)
-          s_spin_rotation = FastMath_normalizeAngleRad( s_spin_rotation + (float)s_spin_speed * SPIN_ROTATION_QUANTA ) ;
+    if (s_cam_glideSteps < CAM3D_GLIDE_STEPS)
+      ++s_cam_glideSteps ;
 
-        cam_rotation = s_spin_rotation ;
-        break ;
+    if (s_world_mode == WORLD_MODE_DYNAMIC)
+    {
+      // Friction: gradualy decrease spin speed until it stops.
+      if (s_spin_speed > 0)
+        --s_spin_speed ;
 
-      case WORLD_MODE_STEADY:
-      default:
-        cam_rotation = SPIN_ROTATION_STEADY ;
-        break ;
+      if (s_spin_speed < 0)
+        ++s_spin_speed ;
+
+      if (s_spin_speed != 0)
+#if defined(FIXED_POINT)
+        s_spin_rotation += (SpinRotation)s_spin_speed * SPIN_ROTATION_QUANTA ;    // Wraps around.
+#else
+        s_spin_rotation = FastMath_normalizeAngleRad( s_spin_rotation + (float)s_spin_speed * SPIN_ROTATION_QUANTA ) ;
+#endif
+    }
+  }
+
+  // Read from the wall clock: once per update, whatever the steps caught up.
+  if (s_world_mode != WORLD_MODE_STEADY  &&  ANIMATION_HUNDREDTHS)
+    Clock3D_second100ths_update( &s_clock ) ;
+
+  PROFILE_END( PROFILE_STAGE_ANIMATION ) ;
+
+  if (s_world_mode != WORLD_MODE_STEADY)
+  {
+    // The filter is fed in batches by accel_data_service_handler( ). If the accel service is not
+    // available it keeps its STEADY viewPoint attractor seed from world_initialize( ).
+
+    const SpinRotation cam_rotation = s_world_mode == WORLD_MODE_DYNAMIC ? s_spin_rotation : SPIN_ROTATION_STEADY ;
+
+    PROFILE_BEGIN( PROFILE_STAGE_CAMERA ) ;
+
+    int32_t accelX, accelY, accelZ ;
+    cam_glide_viewPoint( &accelX, &accelY, &accelZ ) ;
+
+    // Rebuild the camera only if the viewPoint moved noticeably, a spin alone rotates the built one.
+    if ( !s_cam_isValid
+      ||  s_cam_spins >= CAM3D_SPINS_MAX
+      ||  abs( accelX - s_cam_viewPointX ) + abs( accelY - s_cam_viewPointY ) + abs( accelZ - s_cam_viewPointZ ) > CAM3D_VIEWPOINT_EPSILON
+       )
+    {
+#if defined(FIXED_POINT)
+      cam_config( accelX, -accelY, -accelZ, cam_rotation ) ;
+#else
+      cam_config( &(R3){ .x = (float)accelX, .y = -(float)accelY, .z = -(float)accelZ }, cam_rotation ) ;
+#endif
+
+      s_cam_isValid    = true ;
+      s_cam_spins      = 0 ;
+      s_cam_rotation   = cam_rotation ;
+      s_cam_viewPointX = accelX ;
+      s_cam_viewPointY = accelY ;
+      s_cam_viewPointZ = accelZ ;
+      s_world_isDirty  = true ;
+    }
+    else if (cam_rotation != s_cam_rotation)
+    {
+#if defined(FIXED_POINT)
+      cam_spin( (int32_t)((cam_rotation >> 16) - (s_cam_rotation >> 16)) & (TRIG_MAX_ANGLE - 1) ) ;    // As cam_config( ) sees them.
+      s_cam_rotation  = cam_rotation ;
+      s_world_isDirty = true ;
+      ++s_cam_spins ;
+#else
+      // Whole TRIG_MAX_ANGLE units only, the remainder is left for the next update.
+      const int32_t angle = (int32_t)(FastMath_normalizeAngleRad( cam_rotation - s_cam_rotation ) * (TRIG_MAX_ANGLE / (8 * DEG_045))) ;
+
+      if (angle != 0)
+      {
+        cam_spin( angle & (TRIG_MAX_ANGLE - 1) ) ;
+        s_cam_rotation  = FastMath_normalizeAngleRad( s_cam_rotation + (float)angle * (8 * DEG_045 / TRIG_MAX_ANGLE) ) ;
+        s_world_isDirty = true ;
+        ++s_cam_spins ;
+      }
+#endif
     }
 
-    cam_config( &(R3){ .x = (float)(sampler_accelX->samplesAcum / sampler_accelX->samplesNum)
-                     , .y =-(float)(sampler_accelY->samplesAcum / sampler_accelY->samplesNum)
-                     , .z =-(float)(sampler_accelZ->samplesAcum / sampler_accelZ->samplesNum)
-                     }
-              , cam_rotation
-              ) ;
+    PROFILE_END( PROFILE_STAGE_CAMERA ) ;
+  }
+
+  // Besides the events (tick, user interaction, mode or tier change), only a flip step, a camera move, a new
+  // hundredths value or an ink blinker phase change the frame: otherwise the draw is skipped.
+  if (s_world_mode != WORLD_MODE_STEADY  &&  ANIMATION_HUNDREDTHS)
+  {
+    const uint32_t hundredths = Timing_nowMs( ) / 10 ;
+
+    if (hundredths != s_world_hundredths)
+    {
+      s_world_hundredths = hundredths ;
+      s_world_isDirty    = true ;
+    }
   }
 
+  if (blinker_phaseChanged( ))
+    s_world_isDirty = true ;
+
+#if defined(BENCH)
+  s_world_isDirty = true ;    // Benchmark measures every frame.
+#endif
+
   // this will queue a defered call to the world_draw( ) method.
-  layer_mark_dirty( s_world_layer ) ;
+  if (s_world_isDirty)
+    layer_mark_dirty( s_world_layer ) ;
+}
+
+
+// Benchmark related
+#if defined(BENCH)
+
+#define BENCH_FRAMES          250     // Frames sampled per world mode/transparency mode combination.
+#define BENCH_ACCEL_SAMPLES 20000     // Samples pushed per accel filter benchmark.
+
+static const WorldMode         s_bench_worldModes[]        = { WORLD_MODE_DYNAMIC, WORLD_MODE_STEADY } ;
+static const char             *s_bench_worldNames[]        = { "DYNAMIC", "STEADY" } ;
+static const MeshTransparency  s_bench_transparencyModes[] = { MESH_TRANSPARENCY_SOLID, MESH_TRANSPARENCY_XRAY, MESH_TRANSPARENCY_WIREFRAME } ;
+static const char             *s_bench_transparencyNames[] = { "SOLID", "XRAY", "WIREFRAME" } ;
+
+#define BENCH_WORLD_MODES          (sizeof(s_bench_worldModes)        / sizeof(s_bench_worldModes[0]))
+#define BENCH_TRANSPARENCY_MODES   (sizeof(s_bench_transparencyModes) / sizeof(s_bench_transparencyModes[0]))
+#define BENCH_RUNS                 (BENCH_WORLD_MODES * BENCH_TRANSPARENCY_MODES)
+
+static uint16_t  s_bench_updateMs[BENCH_FRAMES] ;
+static uint16_t  s_bench_drawMs[BENCH_FRAMES] ;
+static int       s_bench_frame = 0 ;     // Frames sampled so far on the current run.
+static int       s_bench_run   = 0 ;     // Current world mode/transparency mode combination.
+
+
+static
+void
+bench_accelFilter
+( )
+{ // Ingestion + mean of BENCH_ACCEL_SAMPLES samples: 3 x Sampler vs AccelFilter (every kernel).
+  Sampler *samplerX = Sampler_new( ACCELFILTER_CAPACITY ) ;
+  Sampler *samplerY = Sampler_new( ACCELFILTER_CAPACITY ) ;
+  Sampler *samplerZ = Sampler_new( ACCELFILTER_CAPACITY ) ;
+  int32_t  checksum = 0 ;
+  uint32_t start_ms = Timing_nowMs( ) ;
+
+  for (int i = 0  ;  i < BENCH_ACCEL_SAMPLES  ;  ++i)
+  {
+    Sampler_push( samplerX, ACCEL_STEADY_X + (i & 63) ) ;
+    Sampler_push( samplerY, ACCEL_STEADY_Y - (i & 31) ) ;
+    Sampler_push( samplerZ, ACCEL_STEADY_Z + (i & 15) ) ;
+    checksum += samplerX->samplesAcum / samplerX->samplesNum
+              + samplerY->samplesAcum / samplerY->samplesNum
+              + samplerZ->samplesAcum / samplerZ->samplesNum ;
+  }
+
+  APP_LOG( APP_LOG_LEVEL_INFO, "BENCH accel Sampler x3: %d samples in %d ms (%d)", BENCH_ACCEL_SAMPLES, (int)(Timing_nowMs( ) - start_ms), (int)checksum ) ;
+
+  Sampler_free( samplerX ) ;
+  Sampler_free( samplerY ) ;
+  Sampler_free( samplerZ ) ;
+
+  static const char *kernelNames[] = { "BOXCAR", "EXPONENTIAL", "ONEEURO" } ;
+
+  for (AccelFilterKernel kernel = ACCELFILTER_KERNEL_BOXCAR  ;  kernel <= ACCELFILTER_KERNEL_ONEEURO  ;  ++kernel)
+  {
+    AccelFilter filter ;
+    AccelFilter_initialize( &filter, kernel, ACCEL_STEADY_X, ACCEL_STEADY_Y, ACCEL_STEADY_Z ) ;
+
+    checksum = 0 ;
+    start_ms = Timing_nowMs( ) ;
+
+    for (int i = 0  ;  i < BENCH_ACCEL_SAMPLES  ;  ++i)
+    {
+      int32_t x, y, z ;
+
+      AccelFilter_push( &filter, ACCEL_STEADY_X + (i & 63), ACCEL_STEADY_Y - (i & 31), ACCEL_STEADY_Z + (i & 15) ) ;
+      AccelFilter_get( &filter, &x, &y, &z ) ;
+      checksum += x + y + z ;
+    }
+
+    APP_LOG( APP_LOG_LEVEL_INFO, "BENCH accel AccelFilter %s: %d samples in %d ms (%d)", kernelNames[kernel], BENCH_ACCEL_SAMPLES, (int)(Timing_nowMs( ) - start_ms), (int)checksum ) ;
+  }
+}
+
+
+static
+void
+bench_gesture
+( )
+{ // GestureRecognizer over BENCH_ACCEL_SAMPLES samples of a synthetic trace over the STEADY rest posture, one
+  // gesture every 64 samples: a 2 sample punch (X), a 2 sample twist (Y), then 3 spike shakes dominant on Z, X
+  // and Y. Reports CPU per ACCEL_SAMPLES_PER_UPDATE batch, the gestures recognized right and wrong, and the mean
+  // latency (samples) from a gesture first spike sample to its report.
+  static const GestureType expected[] = { GESTURE_PUNCH, GESTURE_TWIST, GESTURE_SHAKE, GESTURE_SHAKE, GESTURE_SHAKE } ;
+
+  #define BENCH_GESTURE_KINDS   (int)(sizeof(expected) / sizeof(expected[0]))
+
+  GestureRecognizer recognizer ;
+  GestureRecognizer_initialize( &recognizer, ACCEL_STEADY_X, ACCEL_STEADY_Y, ACCEL_STEADY_Z ) ;
+
+  int      right       = 0 ;
+  int      wrong       = 0 ;
+  int      latencySum  = 0 ;
+  int      strengthSum = 0 ;
+  uint32_t start_ms    = Timing_nowMs( ) ;
+
+  for (int i = 0  ;  i < BENCH_ACCEL_SAMPLES  ;  ++i)
+  {
+    const int phase = i & 63 ;
+    const int kind  = (i >> 6) % BENCH_GESTURE_KINDS ;
+    int16_t   x     = ACCEL_STEADY_X + (i & 7) ;    // Rest noise.
+    int16_t   y     = ACCEL_STEADY_Y - (i & 3) ;
+    int16_t   z     = ACCEL_STEADY_Z ;
+
+    const bool    isShakeSpike = phase == 0  ||  phase == 4  ||  phase == 8 ;
+    const int16_t shakeSpike   = (phase == 4) ? -1500 : 1500 ;    // Back and forth.
+
+    switch (kind)
+    {
+      case 0:  if (phase <= 1)  x += 1500 ;        break ;
+      case 1:  if (phase <= 1)  y += 1200 ;        break ;
+      case 2:  if (isShakeSpike)  z += shakeSpike ;  break ;
+      case 3:  if (isShakeSpike)  x += shakeSpike ;  break ;
+      case 4:  if (isShakeSpike)  y += shakeSpike ;  break ;
+    }
+
+    int16_t           strength ;
+    const GestureType gesture = GestureRecognizer_push( &recognizer, x, y, z, &strength ) ;
+
+    if (gesture == GESTURE_NONE)
+      continue ;
+
+    if (gesture != expected[kind])
+    {
+      ++wrong ;
+      continue ;
+    }
+
+    ++right ;
+    latencySum  += phase ;
+    strengthSum += strength ;
+  }
+
+  const uint32_t elapsed_ms = Timing_nowMs( ) - start_ms ;
+
+  APP_LOG( APP_LOG_LEVEL_INFO, "BENCH gesture: %d samples in %d ms (%d us/batch of %d)"
+         , BENCH_ACCEL_SAMPLES, (int)elapsed_ms, (int)(elapsed_ms * 1000 * ACCEL_SAMPLES_PER_UPDATE / BENCH_ACCEL_SAMPLES), ACCEL_SAMPLES_PER_UPDATE
+         ) ;
+
+  APP_LOG( wrong > 0 ? APP_LOG_LEVEL_ERROR : APP_LOG_LEVEL_INFO
+         , "BENCH gesture: %d right, %d wrong of %d, mean latency %d/10 samples, mean strength %d mG"
+         , right, wrong, (BENCH_ACCEL_SAMPLES + 63) / 64
+         , right > 0 ? latencySum * 10 / right : 0
+         , right > 0 ? strengthSum / right : 0
+         ) ;
+}
+
+
+// cam_viewPoint_fixed( ) error limit, parts per million of CAM3D_DISTANCEFROMORIGIN: 2500 ppm is ~1/4 pixel on screen.
+// The integer mG rotation truncates by up to 1 mG, i.e. ~2000 ppm on the shortest (500 mG) viewPoints swept.
+#define BENCH_CAM_ERROR_MAX_PPM   2500
+#define BENCH_CAM_ACCEL_STEP       250    // mG grid step per axis, over [-2000, 2000].
+#define BENCH_CAM_ROTATIONS         64    // Spin rotations per viewPoint, off the sin_lookup( ) table steps.
+
+typedef void (*BenchCamViewPoint)( R3 *rotatedVP, int32_t x, int32_t y, int32_t z, uint32_t rotZ ) ;
+
+
+static
+float
+bench_r3_error
+( const R3 *a
+, const R3 *b
+)
+{ // Max component difference (L-infinity).
+  const float errorX = a->x > b->x ? a->x - b->x : b->x - a->x ;
+  const float errorY = a->y > b->y ? a->y - b->y : b->y - a->y ;
+  const float errorZ = a->z > b->z ? a->z - b->z : b->z - a->z ;
+
+  return errorX > errorY ? (errorX > errorZ ? errorX : errorZ) : (errorY > errorZ ? errorY : errorZ) ;
+}
+
+static volatile float  s_bench_camSink ;
+
+static
+void
+bench_camViewPoint_float
+( R3             *rotatedVP
+, const int32_t   x
+, const int32_t   y
+, const int32_t   z
+, const uint32_t  rotZ    // Binary angle.
+)
+{ // The float cam_config( ) viewPoint math.
+  R3 scaledVP ;
+  R3_scaTo( &scaledVP, CAM3D_DISTANCEFROMORIGIN, &(R3){ .x = (float)x, .y = (float)y, .z = (float)z } ) ;
+  R3_rotZrad( rotatedVP, &scaledVP, (float)(int32_t)rotZ * (DEG_045 / (1 << 29)) ) ;
+}
+
+
+static
+uint32_t
+bench_camViewPoint_time
+( BenchCamViewPoint viewPoint )
+{ // ms taken by one viewPoint path over the bench_camViewPoint( ) grid, its results summed into a sink so none is optimized away.
+  float          sum      = 0.0f ;
+  const uint32_t start_ms = Timing_nowMs( ) ;
+
+  for (int32_t x = -2000  ;  x <= 2000  ;  x += BENCH_CAM_ACCEL_STEP)
+    for (int32_t y = -2000  ;  y <= 2000  ;  y += BENCH_CAM_ACCEL_STEP)
+      for (int32_t z = -2000  ;  z <= 2000  ;  z += BENCH_CAM_ACCEL_STEP)
+      {
+        const int32_t lengthSquared = x * x + y * y + z * z ;
+
+        if (lengthSquared < 500 * 500  ||  lengthSquared > 2000 * 2000)
+          continue ;
+
+        for (uint32_t r = 0  ;  r < BENCH_CAM_ROTATIONS  ;  ++r)
+        {
+          R3 vp ;
+          viewPoint( &vp, x, y, z, r * (UINT32_MAX / BENCH_CAM_ROTATIONS) + r * 12345 ) ;
+          sum += vp.x + vp.y + vp.z ;
+        }
+      }
+
+  s_bench_camSink = sum ;
+  return Timing_nowMs( ) - start_ms ;
+}
+
+
+static
+void
+bench_camViewPoint
+( )
+{ // Fixed point camera viewPoint against the float R3_scaTo( ) + R3_rotZrad( ) path, over an accel grid (gravity like
+  // lengths only: 500..2000 mG) times BENCH_CAM_ROTATIONS spin rotations. Logs PASS/FAIL against BENCH_CAM_ERROR_MAX_PPM,
+  // the max error (L-infinity) and where it occurs.
+  float    errorMax  = 0.0f ;
+  int32_t  worstX    = 0, worstY = 0, worstZ = 0 ;
+  uint32_t worstRotZ = 0 ;
+  int      samples   = 0 ;
+
+  for (int32_t x = -2000  ;  x <= 2000  ;  x += BENCH_CAM_ACCEL_STEP)
+    for (int32_t y = -2000  ;  y <= 2000  ;  y += BENCH_CAM_ACCEL_STEP)
+      for (int32_t z = -2000  ;  z <= 2000  ;  z += BENCH_CAM_ACCEL_STEP)
+      {
+        const int32_t lengthSquared = x * x + y * y + z * z ;
+
+        if (lengthSquared < 500 * 500  ||  lengthSquared > 2000 * 2000)
+          continue ;
+
+        for (uint32_t r = 0  ;  r < BENCH_CAM_ROTATIONS  ;  ++r)
+        {
+          const uint32_t rotZ = r * (UINT32_MAX / BENCH_CAM_ROTATIONS) + r * 12345 ;    // Binary angle.
+
+          R3 fixedVP ;
+          cam_viewPoint_fixed( &fixedVP, x, y, z, rotZ ) ;
+
+          R3 floatVP ;
+          bench_camViewPoint_float( &floatVP, x, y, z, rotZ ) ;
+
+          const float error = bench_r3_error( &fixedVP, &floatVP ) ;
+
+          if (error > errorMax)
+          {
+            errorMax  = error ;
+            worstX    = x ;
+            worstY    = y ;
+            worstZ    = z ;
+            worstRotZ = rotZ ;
+          }
+
+          ++samples ;
+        }
+      }
+
+  const int errorMaxPpm = (int)(errorMax * 1000000 / CAM3D_DISTANCEFROMORIGIN) ;
+
+  APP_LOG( errorMaxPpm > BENCH_CAM_ERROR_MAX_PPM ? APP_LOG_LEVEL_ERROR : APP_LOG_LEVEL_INFO
+         , "BENCH cam fixed vs float %s: max error %d ppm of the camera distance (limit %d) at accel (%d, %d, %d) rotation %d/65536, %d samples"
+         , errorMaxPpm > BENCH_CAM_ERROR_MAX_PPM ? "FAIL" : "PASS"
+         , errorMaxPpm, BENCH_CAM_ERROR_MAX_PPM
+         , (int)worstX, (int)worstY, (int)worstZ, (int)(worstRotZ >> 16)
+         , samples
+         ) ;
+
+  // Timed apart: FIXED_POINT (Config.h) is only worth enabling on the platforms where the fixed point path wins.
+  const uint32_t fixed_ms = bench_camViewPoint_time( cam_viewPoint_fixed ) ;
+  const uint32_t float_ms = bench_camViewPoint_time( bench_camViewPoint_float ) ;
+
+  APP_LOG( APP_LOG_LEVEL_INFO
+         , "BENCH cam viewPoint: fixed point %d ms, float %d ms for %d samples, %s faster"
+         , (int)fixed_ms, (int)float_ms, samples
+         , fixed_ms < float_ms ? "fixed point" : "float"
+         ) ;
+}
+
+
+// cam_spin( ) error limit after CAM3D_SPINS_MAX incremental spins (what world_update( ) allows before a rebuild),
+// parts per million of the basis unit vectors and of CAM3D_DISTANCEFROMORIGIN for the viewPoint.
+#define BENCH_CAM_SPIN_ERROR_MAX_PPM   2500
+
+static
+void
+bench_camSpin_config
+( const int32_t x    // Accel units (mG), as world_update( ) passes them.
+, const int32_t y
+, const int32_t z
+, const int32_t angle    // TRIG_MAX_ANGLE units.
+)
+{
+#if defined(FIXED_POINT)
+  cam_config( x, -y, -z, (SpinRotation)angle << 16 ) ;
+#else
+  cam_config( &(R3){ .x = (float)x, .y = -(float)y, .z = -(float)z }, (float)angle * (8 * DEG_045 / TRIG_MAX_ANGLE) ) ;
+#endif
+}
+
+
+static
+void
+bench_camSpin
+( )
+{ // The world_update( ) incremental camera spin against a full rebuild: for accel viewPoints off the vertical and a few
+  // spin steps, CAM3D_SPINS_MAX cam_spin( ) steps of a built camera, then cam_config( ) straight at the final rotation.
+  // Logs PASS/FAIL against BENCH_CAM_SPIN_ERROR_MAX_PPM, the max error (L-infinity over viewPoint, u, v & w).
+  static const int32_t steps[] = { 1, 37, 410, 2048, TRIG_MAX_ANGLE - 3001 } ;    // TRIG_MAX_ANGLE units, last one backwards.
+
+  float errorMaxPpm = 0.0f ;
+  int   cameras     = 0 ;
+
+  for (int32_t x = -1000  ;  x <= 1000  ;  x += 500)
+    for (int32_t y = -1000  ;  y <= 1000  ;  y += 500)
+      for (int32_t z = -1000  ;  z <= 1000  ;  z += 500)
+      {
+        if (x * x + y * y < 500 * 500)    // Near the vertical the upwards basis is ill defined, rebuilds included.
+          continue ;
+
+        for (int s = 0  ;  s < (int)(sizeof(steps) / sizeof(steps[0]))  ;  ++s)
+        {
+          bench_camSpin_config( x, y, z, 1234 ) ;
+
+          for (int spin = 0  ;  spin < CAM3D_SPINS_MAX  ;  ++spin)
+            cam_spin( steps[s] ) ;
+
+          const CamR3 spun = s_cam ;
+          bench_camSpin_config( x, y, z, (1234 + CAM3D_SPINS_MAX * steps[s]) & (TRIG_MAX_ANGLE - 1) ) ;
+
+          const float errorsPpm[] = { bench_r3_error( &spun.viewPoint, &s_cam.viewPoint ) * 1000000 / CAM3D_DISTANCEFROMORIGIN
+                                    , bench_r3_error( &spun.u        , &s_cam.u         ) * 1000000
+                                    , bench_r3_error( &spun.v        , &s_cam.v         ) * 1000000
+                                    , bench_r3_error( &spun.w        , &s_cam.w         ) * 1000000
+                                    } ;
+
+          for (int e = 0  ;  e < 4  ;  ++e)
+            if (errorsPpm[e] > errorMaxPpm)
+              errorMaxPpm = errorsPpm[e] ;
+
+          ++cameras ;
+        }
+      }
+
+  s_cam_isValid = false ;    // s_cam was clobbered: the first world_update( ) rebuilds it.
+
+  APP_LOG( errorMaxPpm > BENCH_CAM_SPIN_ERROR_MAX_PPM ? APP_LOG_LEVEL_ERROR : APP_LOG_LEVEL_INFO
+         , "BENCH cam spin vs rebuild %s: max error %d ppm (limit %d) after %d incremental spins, %d cameras"
+         , errorMaxPpm > BENCH_CAM_SPIN_ERROR_MAX_PPM ? "FAIL" : "PASS"
+         , (int)errorMaxPpm, BENCH_CAM_SPIN_ERROR_MAX_PPM, CAM3D_SPINS_MAX, cameras
+         ) ;
+}
+
+
+static
+void
+bench_run_start
+( )
+{
+  s_bench_frame      = 0 ;
+  s_transparencyMode = s_bench_transparencyModes[s_bench_run % BENCH_TRANSPARENCY_MODES] ;
+  set_world_mode( s_bench_worldModes[s_bench_run / BENCH_TRANSPARENCY_MODES] ) ;
+
+  if (s_world_mode == WORLD_MODE_DYNAMIC)
+    s_spin_speed = SPIN_SPEED_PUNCH_STEP ;     // Exercise the spinning camera path, friction will not stop it within BENCH_FRAMES.
+}
+
+
+static
+void
+bench_run_report
+( )
+{
+  int overBudget = 0 ;
+
+  for (int i = 0  ;  i < BENCH_FRAMES  ;  ++i)
+    if (s_bench_updateMs[i] + s_bench_drawMs[i] > ANIMATION_INTERVAL_MS)
+      ++overBudget ;
+
+  Timing_sort( s_bench_updateMs, BENCH_FRAMES ) ;
+  Timing_sort( s_bench_drawMs  , BENCH_FRAMES ) ;
+
+  APP_LOG( APP_LOG_LEVEL_INFO
+         , "BENCH %s/%s update(ms) p50=%u p90=%u p99=%u max=%u draw(ms) p50=%u p90=%u p99=%u max=%u over%dms=%d/%d"
+         , s_bench_worldNames[s_bench_run / BENCH_TRANSPARENCY_MODES]
+         , s_bench_transparencyNames[s_bench_run % BENCH_TRANSPARENCY_MODES]
+         , s_bench_updateMs[BENCH_FRAMES * 50 / 100], s_bench_updateMs[BENCH_FRAMES * 90 / 100], s_bench_updateMs[BENCH_FRAMES * 99 / 100], s_bench_updateMs[BENCH_FRAMES - 1]
+         , s_bench_drawMs[BENCH_FRAMES * 50 / 100]  , s_bench_drawMs[BENCH_FRAMES * 90 / 100]  , s_bench_drawMs[BENCH_FRAMES * 99 / 100]  , s_bench_drawMs[BENCH_FRAMES - 1]
+         , ANIMATION_INTERVAL_MS, overBudget, BENCH_FRAMES
+         ) ;
+}
+
+
+static
+void
+bench_update_record
+( uint32_t updateMs )
+{
+  s_bench_updateMs[s_bench_frame] = updateMs ;
+}
+
+
+static
+void
+bench_draw_record
+( uint32_t drawMs )
+{
+  s_bench_drawMs[s_bench_frame] = drawMs ;
+
+  if (++s_bench_frame < BENCH_FRAMES)
+    return ;
+
+  bench_run_report( ) ;
+
+  if (++s_bench_run < (int)BENCH_RUNS)
+    bench_run_start( ) ;
+  else
+  {
+    APP_LOG( APP_LOG_LEVEL_INFO, "BENCH done" ) ;
+    window_stack_pop_all( true ) ;    // Exit app.
+  }
 }
 
+#endif
+
 
 #if defined(LOG)
 static int s_world_draw_count = 0 ;
 #endif
 
+#define PROFILE_STAGE_DRAW(transparencyMode)                                                 \
+  ( (transparencyMode) == MESH_TRANSPARENCY_XRAY      ? PROFILE_STAGE_DRAW_XRAY              \
+  : (transparencyMode) == MESH_TRANSPARENCY_WIREFRAME ? PROFILE_STAGE_DRAW_WIREFRAME         \
+  :                                                     PROFILE_STAGE_DRAW_SOLID             \
+  )
+
 void
 world_draw
 ( Layer    *me
@@ -566,35 +1596,36 @@ world_draw
 )
 {
   LOGD( "world_draw:: count = %d", ++s_world_draw_count ) ;
+  HEAP_CHECK_FRAME_BEGIN( s_world_updateCount ) ;
+
+  s_world_isDirty = false ;
 
   // Disable antialiasing if running under QEMU (crashes after a few frames otherwise).
 #if defined(QEMU)
     graphics_context_set_antialiased( gCtx, false ) ;
 #endif
 
-  Clock3D_draw( gCtx, &s_clock, &s_cam, available_screen.w, available_screen.h, s_transparencyMode ) ;
-}
+#if defined(BENCH) || defined(GOVERNOR)
+  const uint32_t start_ms = Timing_nowMs( ) ;
+#endif
 
+  const MeshTransparency transparencyMode = ANIMATION_TRANSPARENCY ;    // The user choice, unless the governor fell back.
 
-static
-void
-interpolations_finalize
-( )
-{
-  free( animRotationFraction    ) ; animRotationFraction    = NULL ;
-  free( animTranslationFraction ) ; animTranslationFraction = NULL ;
-  free( spinRotationFraction    ) ; spinRotationFraction    = NULL ;
-}
+  PROFILE_BEGIN( PROFILE_STAGE_DRAW(transparencyMode) ) ;
+  Clock3D_draw( gCtx, &s_clock, &s_cam, available_screen.w, available_screen.h, transparencyMode ) ;
+  PROFILE_END( PROFILE_STAGE_DRAW(transparencyMode) ) ;
+  PROFILE_END( PROFILE_STAGE_TIMER_TO_DRAW ) ;
+
+#if defined(BENCH)
+  bench_draw_record( Timing_nowMs( ) - start_ms ) ;
+#endif
 
+#if defined(GOVERNOR)
+  if (Governor_frameCost( &s_governor, s_governor_updateMs + Timing_nowMs( ) - start_ms ))
+    s_world_isDirty = true ;    // Next frame at the new tier quality.
+#endif
 
-static
-void
-sampler_finalize
-( )
-{
-  Sampler_free( sampler_accelX ) ;
-  Sampler_free( sampler_accelY ) ;
-  Sampler_free( sampler_accelZ ) ;
+  HEAP_CHECK_FRAME_END( ) ;
 }
 
 
@@ -603,23 +1634,119 @@ world_finalize
 ( )
 {
   Clock3D_finalize( &s_clock ) ;
-  sampler_finalize( ) ;
-  interpolations_finalize( ) ;
 
+#if !defined(BENCH)    // Benchmark cycles trough the modes, do not clobber the user configuration.
   // Save current configuration into persistent storage on app exit.
   persist_write_int( PKEY_WORLD_MODE       , s_world_mode       ) ;
   persist_write_int( PKEY_TRANSPARENCY_MODE, s_transparencyMode ) ;
+#endif
+
+#if defined(WORLD_SNAPSHOT)
+  world_snapshot_save( ) ;
+#endif
 }
 
 
+#if defined(REPLAY)
+
+static const ClickHandler s_replay_buttonHandlers[] = { [INPUT_BUTTON_SPIN_INCREMENT     ] = spinSpeed_increment_click_handler
+                                                      , [INPUT_BUTTON_SPIN_DECREMENT     ] = spinSpeed_decrement_click_handler
+                                                      , [INPUT_BUTTON_TRANSPARENCY_CHANGE] = transparencyMode_change_click_handler
+                                                      , [INPUT_BUTTON_DISPLAYTYPE_CYCLE  ] = displayType_cycle_click_handler
+                                                      , [INPUT_BUTTON_CONFIGMODE_ENTER   ] = configMode_enter_click_handler
+                                                      , [INPUT_BUTTON_CONFIGMODE_EXIT    ] = configMode_exit_click_handler
+                                                      } ;
+
+static
+void
+replay_feed
+( )
+{ // Dispatch the recorded inputs due at this frame to the same handlers the live services call.
+  const InputEvent *event ;
+
+  while ((event = Recorder_replayNext( s_world_updateCount )) != NULL)
+    switch (event->type)
+    {
+      case INPUT_TICK:
+        tick_timer_service_handler( &(struct tm){ .tm_mday = event->x, .tm_hour = event->y / 60, .tm_min = event->y % 60, .tm_sec = event->z }
+                                  , event->arg
+                                  ) ;
+        break ;
+
+      case INPUT_TAP:
+        accel_tap_service_handler( event->arg, event->x ) ;
+        break ;
+
+      case INPUT_BUTTON:
+        s_replay_buttonHandlers[event->arg]( NULL, NULL ) ;
+        break ;
+
+      case INPUT_ACCEL:
+        accel_data_service_handler( &(AccelData){ .x = event->x, .y = event->y, .z = event->z, .did_vibrate = event->arg }, 1 ) ;
+        break ;
+
+      case INPUT_STEPS:
+        s_replay_steps = event->arg ;
+        break ;
+
+      default:
+        break ;
+    }
+
+  if (Recorder_replayDone( ))
+  {
+    APP_LOG( APP_LOG_LEVEL_INFO, "REPLAY done, %d frames", s_world_updateCount ) ;
+    window_stack_pop_all( true ) ;    // Exit app.
+  }
+}
+
+#endif
+
+
 void
 world_update_timer_handler
 ( void *data )
 {
+  PROFILE_BEGIN( PROFILE_STAGE_TIMER_TO_DRAW ) ;
+
+  s_world_isUpdating = true ;
+
+#if defined(REPLAY)
+  replay_feed( ) ;    // May go dormant, and wake up again, from inside this handler.
+
+  // Inputs recorded while dormant carry the frame of the update before it (none ran meanwhile): they were all
+  // replayed above, the waking one included. Still dormant means the log ended there: no more updates.
+  if (s_world_isDormant)
+  {
+    s_world_isUpdating      = false ;
+    s_world_updateTimer_ptr = NULL ;
+    return ;
+  }
+#endif
+
+  HEAP_CHECK_FRAME_BEGIN( s_world_updateCount + 1 ) ;    // world_update( ) increments it.
+
+#if defined(BENCH)
+  const uint32_t start_ms = Timing_nowMs( ) ;
   world_update( ) ;
+  bench_update_record( Timing_nowMs( ) - start_ms ) ;
+#elif defined(GOVERNOR)
+  const uint32_t start_ms = Timing_nowMs( ) ;
+  world_update( ) ;
+  s_governor_updateMs = Timing_nowMs( ) - start_ms ;
+#else
+  world_update( ) ;
+#endif
+
+  HEAP_CHECK_FRAME_END( ) ;
 
-  // Call me again.
-  s_world_updateTimer_ptr = app_timer_register( ANIMATION_INTERVAL_MS, world_update_timer_handler, data ) ;
+  // Call me again, at the governor frame rate only if something is moving.
+  s_world_isUpdating      = false ;
+  s_world_isIdle          = !world_isAnimating( ) ;
+  s_world_updateTimer_ptr = app_timer_register( s_world_isIdle ? ANIMATION_IDLE_INTERVAL_MS : ANIMATION_FRAME_MS
+                                              , world_update_timer_handler
+                                              , data
+                                              ) ;
 }
 
 
@@ -628,23 +1755,41 @@ world_start
 ( )
 { // Position s_clock handles according to current time.
   // Initialize blinkers.
+  s_blinker_clockMinutes_ms = Timing_nowMs( ) ;
   Blinker_start( &clock_minutes_inkBlinker
-               , 500      // lengthOn (ms)
-               , 500      // lengthOff (ms)
+               , BLINKER_CLOCK_MINUTES_MS    // lengthOn (ms)
+               , BLINKER_CLOCK_MINUTES_MS    // lengthOff (ms)
                , INK100   // inkOn (100%)
                , INK50    // inkOff (50%)
                ) ;
 
   // Set initial world mode (and subscribe to related services).
+#if defined(BENCH)
+  bench_accelFilter( ) ;
+  bench_gesture( ) ;
+  bench_camViewPoint( ) ;
+  bench_camSpin( ) ;
+  bench_run_start( ) ;
+#else
   set_world_mode( s_world_mode ) ;                                               
+#endif
 
+#if !defined(REPLAY)    // Ticks & taps replayed from the log.
   // Activate s_clock
   tick_timer_service_subscribe( SECOND_UNIT, tick_timer_service_handler ) ;    
 
   // Become tap aware.
   accel_tap_service_subscribe( accel_tap_service_handler ) ;                   
+#endif
+
+#if defined(GOVERNOR)
+  // Become battery aware.
+  battery_state_service_handler( battery_state_service_peek( ) ) ;
+  battery_state_service_subscribe( battery_state_service_handler ) ;
+#endif
 
   // Trigger call to launch animation, will self repeat.
+  s_animation_ms = Timing_nowMs( ) ;
   world_update_timer_handler( NULL ) ;
 }
 
@@ -669,6 +1814,64 @@ world_stop
 
   // Compass unaware.
   compass_service_unsubscribe( ) ;                 
+
+#if defined(GOVERNOR)
+  // Battery unaware.
+  battery_state_service_unsubscribe( ) ;
+#endif
+}
+
+
+void
+world_dormant_enter
+( )
+{ // Instead of exiting the app: keep the window, stop everything but minute ticks, taps and buttons.
+  if (s_user_configMode)    // Its blinker would blank the static frame about half of the time.
+    configMode_exit( ) ;
+
+  s_world_isDormant = true ;
+  s_flip_framesLeft = 0 ;
+
+  Blinker_stop( &clock_minutes_inkBlinker ) ;
+  app_timer_cancel( s_world_updateTimer_ptr ) ;
+  accel_data_service_unsubscribe( ) ;
+
+#if !defined(REPLAY)
+  tick_timer_service_subscribe( MINUTE_UNIT, tick_timer_service_handler ) ;
+#endif
+
+  // Draw the static frame, without blinking ink.
+  s_world_isDirty = true ;
+  layer_mark_dirty( s_world_layer ) ;
+}
+
+
+void
+world_dormant_exit
+( )
+{ // Full rate animation again, from the current state: nothing to re-initialize.
+  s_world_isDormant      = false ;
+  s_world_isIdle         = false ;
+  s_user_secondsInactive = 0 ;
+
+  s_blinker_clockMinutes_ms = Timing_nowMs( ) ;
+  Blinker_start( &clock_minutes_inkBlinker
+               , BLINKER_CLOCK_MINUTES_MS    // lengthOn (ms)
+               , BLINKER_CLOCK_MINUTES_MS    // lengthOff (ms)
+               , INK100   // inkOn (100%)
+               , INK50    // inkOff (50%)
+               ) ;
+
+  set_world_mode( s_world_mode ) ;     // Re-subscribes to the accel data service in DYNAMIC mode.
+
+#if !defined(REPLAY)
+  tick_timer_service_subscribe( SECOND_UNIT, tick_timer_service_handler ) ;
+#endif
+
+  s_animation_ms = Timing_nowMs( ) ;
+
+  if (!s_world_isUpdating)    // Otherwise (REPLAY: woken by a replayed input) the running handler re-arms the timer.
+    s_world_updateTimer_ptr = app_timer_register( 0, world_update_timer_handler, NULL ) ;
 }
 
 
@@ -679,6 +1882,7 @@ unobstructed_area_change_handler
 )
 {
   available_screen = layer_get_unobstructed_bounds( s_window_layer ).size ;
+  s_world_isDirty  = true ;     // Redraw at the new size.
 }
 
 
@@ -721,7 +1925,12 @@ void
 app_init
 ( void )
 {
+  ARENA_INITIALIZE( PLATFORM_ARENA_WORLD_BYTES ) ;
+  ARENA_OPEN( ) ;    // Every world object, Clock3D meshes included, comes from the arena.
+
   world_initialize( ) ;
+  ARENA_CLOSE( ) ;
+  PROFILE_HEAP( "world initialized" ) ;
 
   s_window = window_create( ) ;
   window_set_background_color( s_window, GColorBlack ) ;
@@ -744,6 +1953,11 @@ app_deinit
   window_stack_remove( s_window, false ) ;
   window_destroy( s_window ) ;
   world_finalize( ) ;
+
+  PROFILE_REPORT( ANIMATION_INTERVAL_MS ) ;
+  HEAP_CHECK_REPORT( ) ;
+  RECORD_DUMP( ) ;
+  ARENA_FINALIZE( ) ;
 }
 
 
@@ -0,0 +1,227 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : test/AccelFilterTest.c
+
+   AccelFilter kernels against reference results, plus a host timing of each kernel push + get.
+
+   Last revision: 16 October 2026
+*/
+
+#include <time.h>
+#include "AccelFilter.h"
+#include "Test.h"
+
+
+#define REST_X        -81     // main.c STEADY viewPoint attractor.
+#define REST_Y       -816
+#define REST_Z       -571
+
+#define BENCH_SAMPLES  1000000
+
+static const AccelFilterKernel  s_kernels[]     = { ACCELFILTER_KERNEL_BOXCAR, ACCELFILTER_KERNEL_EXPONENTIAL, ACCELFILTER_KERNEL_ONEEURO } ;
+static const char              *s_kernelNames[] = { "BOXCAR", "EXPONENTIAL", "ONEEURO" } ;
+
+#define KERNELS   (int)(sizeof(s_kernels) / sizeof(s_kernels[0]))
+
+
+static
+int32_t
+getX
+( const AccelFilter *filter )
+{
+  int32_t x, y, z ;
+  AccelFilter_get( filter, &x, &y, &z ) ;
+
+  return x ;
+}
+
+
+static
+void
+test_seed
+( )
+{ // Fresh filters read back their seed, and keep it while fed with it.
+  for (int k = 0  ;  k < KERNELS  ;  ++k)
+  {
+    AccelFilter filter ;
+    AccelFilter_initialize( &filter, s_kernels[k], REST_X, REST_Y, REST_Z ) ;
+
+    for (int i = 0  ;  i < 2  ;  ++i)
+    {
+      int32_t x, y, z ;
+      AccelFilter_get( &filter, &x, &y, &z ) ;
+      CHECK( x == REST_X  &&  y == REST_Y  &&  z == REST_Z ) ;
+
+      for (int n = 0  ;  n < 100  ;  ++n)
+        AccelFilter_push( &filter, REST_X, REST_Y, REST_Z ) ;
+    }
+  }
+}
+
+
+static
+void
+test_boxcar
+( )
+{ // Mean of the last ACCELFILTER_CAPACITY samples, per axis, floored.
+  AccelFilter filter ;
+  AccelFilter_initialize( &filter, ACCELFILTER_KERNEL_BOXCAR, REST_X, REST_Y, REST_Z ) ;
+
+  int16_t history[ACCELFILTER_CAPACITY] ;
+
+  for (int i = 0  ;  i < ACCELFILTER_CAPACITY  ;  ++i)
+    history[i] = REST_Y ;
+
+  for (int i = 0  ;  i < 1000  ;  ++i)
+  {
+    const int16_t y = REST_Y + (int16_t)((i * 7919) % 1201) - 600 ;    // Pseudo random walk over +-600 mG.
+
+    AccelFilter_push( &filter, REST_X, y, REST_Z ) ;
+    history[i % ACCELFILTER_CAPACITY] = y ;
+
+    int32_t sum = 0 ;
+
+    for (int h = 0  ;  h < ACCELFILTER_CAPACITY  ;  ++h)
+      sum += history[h] ;
+
+    int32_t fx, fy, fz ;
+    AccelFilter_get( &filter, &fx, &fy, &fz ) ;
+    CHECK( fy == sum >> ACCELFILTER_CAPACITY_LOG2 ) ;
+    CHECK( fx == REST_X  &&  fz == REST_Z ) ;
+  }
+}
+
+
+static
+int
+stepSettle
+( const AccelFilterKernel  kernel
+, int32_t                 *finalX
+)
+{ // Samples a 1000 mG step takes to come within the camera rebuild epsilon, -1 if it never does in 200 samples.
+  AccelFilter filter ;
+  AccelFilter_initialize( &filter, kernel, 0, REST_Y, REST_Z ) ;
+
+  int settledAt = -1 ;
+
+  for (int i = 0  ;  i < 200  ;  ++i)
+  {
+    AccelFilter_push( &filter, 1000, REST_Y, REST_Z ) ;
+
+    if (settledAt < 0  &&  getX( &filter ) >= 1000 - 8)
+      settledAt = i + 1 ;
+  }
+
+  *finalX = getX( &filter ) ;
+  return settledAt ;
+}
+
+
+static
+void
+test_step
+( )
+{ // A 1000 mG step: every kernel settles on it, the boxcar after exactly ACCELFILTER_CAPACITY samples.
+  for (int k = 0  ;  k < KERNELS  ;  ++k)
+  {
+    int32_t   finalX ;
+    const int settledAt = stepSettle( s_kernels[k], &finalX ) ;
+
+    printf( "AccelFilter %-11s step settles in %d samples\n", s_kernelNames[k], settledAt ) ;
+    CHECK( settledAt > 0  &&  finalX <= 1000 ) ;
+
+    if (s_kernels[k] == ACCELFILTER_KERNEL_BOXCAR)
+      CHECK( settledAt == ACCELFILTER_CAPACITY ) ;
+  }
+}
+
+
+static
+void
+test_oneEuro
+( )
+{ // Against the exponential kernel: rest jitter smoothed at least as well, yet less lag on a ramp and a faster step.
+  AccelFilter exponential, oneEuro ;
+
+  AccelFilter_initialize( &exponential, ACCELFILTER_KERNEL_EXPONENTIAL, 0, REST_Y, REST_Z ) ;
+  AccelFilter_initialize( &oneEuro    , ACCELFILTER_KERNEL_ONEEURO    , 0, REST_Y, REST_Z ) ;
+
+  int32_t jitterExponential = 0, jitterOneEuro = 0 ;
+
+  for (int i = 0  ;  i < 200  ;  ++i)
+  {
+    const int16_t x = (i & 1) ? 12 : -12 ;
+
+    AccelFilter_push( &exponential, x, REST_Y, REST_Z ) ;
+    AccelFilter_push( &oneEuro    , x, REST_Y, REST_Z ) ;
+
+    if (i >= 100)
+    {
+      jitterExponential += abs( getX( &exponential ) ) ;
+      jitterOneEuro     += abs( getX( &oneEuro ) ) ;
+    }
+  }
+
+  int32_t lagExponential = 0, lagOneEuro = 0 ;
+
+  for (int i = 1  ;  i <= 40  ;  ++i)
+  {
+    const int16_t x = i * 50 ;
+
+    AccelFilter_push( &exponential, x, REST_Y, REST_Z ) ;
+    AccelFilter_push( &oneEuro    , x, REST_Y, REST_Z ) ;
+
+    lagExponential = x - getX( &exponential ) ;
+    lagOneEuro     = x - getX( &oneEuro ) ;
+  }
+
+  printf( "AccelFilter rest jitter (mG, 100 samples): EXPONENTIAL %d, ONEEURO %d\n", (int)jitterExponential, (int)jitterOneEuro ) ;
+  printf( "AccelFilter 50 mG/sample ramp lag (mG): EXPONENTIAL %d, ONEEURO %d\n", (int)lagExponential, (int)lagOneEuro ) ;
+
+  int32_t   finalX ;
+  const int settleExponential = stepSettle( ACCELFILTER_KERNEL_EXPONENTIAL, &finalX ) ;
+  const int settleOneEuro     = stepSettle( ACCELFILTER_KERNEL_ONEEURO    , &finalX ) ;
+
+  CHECK( jitterOneEuro <= jitterExponential ) ;
+  CHECK( lagOneEuro    <  lagExponential ) ;
+  CHECK( settleOneEuro >  0  &&  settleOneEuro < settleExponential ) ;
+}
+
+
+static
+void
+bench
+( )
+{ // Host timing only, the on-watch figures come from the BENCH build.
+  for (int k = 0  ;  k < KERNELS  ;  ++k)
+  {
+    AccelFilter filter ;
+    AccelFilter_initialize( &filter, s_kernels[k], REST_X, REST_Y, REST_Z ) ;
+
+    volatile int32_t sink = 0 ;
+    const clock_t    start = clock( ) ;
+
+    for (int i = 0  ;  i < BENCH_SAMPLES  ;  ++i)
+    {
+      AccelFilter_push( &filter, REST_X + (i & 63), REST_Y - (i & 31), REST_Z + (i & 15) ) ;
+      sink += getX( &filter ) ;
+    }
+
+    const double ns = (double)(clock( ) - start) * 1e9 / CLOCKS_PER_SEC / BENCH_SAMPLES ;
+    printf( "AccelFilter %-11s push + get: %.1f ns/sample (host)\n", s_kernelNames[k], ns ) ;
+  }
+}
+
+
+int
+main
+( )
+{
+  test_seed( ) ;
+  test_boxcar( ) ;
+  test_step( ) ;
+  test_oneEuro( ) ;
+  bench( ) ;
+
+  return TEST_RESULT( ) ;
+}
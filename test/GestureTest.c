@@ -0,0 +1,192 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : test/GestureTest.c
+
+   GestureRecognizer trace: synthetic spikes over a rest posture in, gestures out.
+
+   Last revision: 16 October 2026
+*/
+
+#include "Gesture.h"
+#include "Test.h"
+
+
+#define REST_X        -81     // main.c STEADY viewPoint attractor.
+#define REST_Y       -816
+#define REST_Z       -571
+
+#define TRACE_GAP      64     // Rest samples after each gesture: far more than GESTURE_SHAKE_GAP.
+
+
+typedef struct
+{ GestureType  gestures[8] ;    // Reported, in order.
+  int16_t      strengths[8] ;
+  int          at[8] ;          // Sample index each was reported on.
+  int          gesturesNum ;
+  int          samples ;        // Pushed so far.
+} Trace ;
+
+
+// Pushes count samples of rest plus (dx, dy, dz), small rest noise included.
+static
+void
+push
+( GestureRecognizer *recognizer
+, Trace             *trace
+, int                count
+, int16_t            dx
+, int16_t            dy
+, int16_t            dz
+)
+{
+  for (int i = 0  ;  i < count  ;  ++i)
+  {
+    int16_t           strength ;
+    const GestureType gesture = GestureRecognizer_push( recognizer, REST_X + dx + (i & 7), REST_Y + dy - (i & 3), REST_Z + dz, &strength ) ;
+
+    if (gesture != GESTURE_NONE  &&  trace->gesturesNum < 8)
+    {
+      trace->gestures [trace->gesturesNum] = gesture ;
+      trace->strengths[trace->gesturesNum] = strength ;
+      trace->at       [trace->gesturesNum] = trace->samples ;
+      ++trace->gesturesNum ;
+    }
+
+    ++trace->samples ;
+  }
+}
+
+
+// Spikes of 2 samples, back and forth, starting every period samples along axis (0 = X, 1 = Y, 2 = Z).
+static
+void
+spikes
+( GestureRecognizer *recognizer
+, Trace             *trace
+, int                spikesNum
+, int                period
+, int                axis
+, int16_t            peak
+)
+{
+  for (int spike = 0  ;  spike < spikesNum  ;  ++spike)
+  {
+    const int16_t signedPeak = (spike & 1) ? -peak : peak ;
+
+    push( recognizer, trace, 2, axis == 0 ? signedPeak : 0, axis == 1 ? signedPeak : 0, axis == 2 ? signedPeak : 0 ) ;
+    push( recognizer, trace, period - 2, 0, 0, 0 ) ;
+  }
+}
+
+
+static
+Trace
+run
+( int      spikesNum
+, int      period
+, int      axis
+, int16_t  peak
+)
+{
+  GestureRecognizer recognizer ;
+  GestureRecognizer_initialize( &recognizer, REST_X, REST_Y, REST_Z ) ;
+
+  Trace trace = { .gesturesNum = 0, .samples = 0 } ;
+
+  push( &recognizer, &trace, TRACE_GAP, 0, 0, 0 ) ;
+  spikes( &recognizer, &trace, spikesNum, period, axis, peak ) ;
+  push( &recognizer, &trace, TRACE_GAP, 0, 0, 0 ) ;
+
+  return trace ;
+}
+
+
+static
+void
+test_single
+( )
+{ // One spike: a punch on X, a twist on Y, a Z tap (reported as a shake) on Z. Reported on the rest sample after
+  // the GESTURE_SHAKE_GAP-th following the spike, the first one no next spike could join it.
+  Trace trace = run( 1, 4, 0, 1500 ) ;
+  CHECK( trace.gesturesNum == 1  &&  trace.gestures[0] == GESTURE_PUNCH ) ;
+  CHECK( trace.strengths[0] >= 1400  &&  trace.strengths[0] <= 1600 ) ;
+  CHECK( trace.at[0] == TRACE_GAP + 2 + GESTURE_SHAKE_GAP ) ;
+
+  trace = run( 1, 4, 1, 1200 ) ;
+  CHECK( trace.gesturesNum == 1  &&  trace.gestures[0] == GESTURE_TWIST ) ;
+
+  trace = run( 1, 4, 2, 1500 ) ;
+  CHECK( trace.gesturesNum == 1  &&  trace.gestures[0] == GESTURE_SHAKE ) ;
+
+  // Under the threshold: nothing.
+  trace = run( 1, 4, 0, GESTURE_SPIKE_THRESHOLD / 2 ) ;
+  CHECK( trace.gesturesNum == 0 ) ;
+
+  // Clamped strength.
+  trace = run( 1, 4, 0, 2 * GESTURE_STRENGTH_MAX ) ;
+  CHECK( trace.gesturesNum == 1  &&  trace.strengths[0] == GESTURE_STRENGTH_MAX ) ;
+}
+
+
+static
+void
+test_shake
+( )
+{ // GESTURE_SHAKE_SPIKES spikes within the window, dominant on any axis: one shake, never a punch/twist first.
+  for (int axis = 0  ;  axis < 3  ;  ++axis)
+  {
+    Trace trace = run( GESTURE_SHAKE_SPIKES, 4, axis, 1500 ) ;
+    CHECK( trace.gesturesNum == 1  &&  trace.gestures[0] == GESTURE_SHAKE ) ;
+
+    // Longer shakes are still a single one.
+    trace = run( GESTURE_SHAKE_SPIKES + 3, 4, axis, 1500 ) ;
+    CHECK( trace.gesturesNum == 1  &&  trace.gestures[0] == GESTURE_SHAKE ) ;
+  }
+
+  // 2 sample spikes GESTURE_SHAKE_GAP rest samples apart still group, one sample further apart they do not.
+  Trace trace = run( GESTURE_SHAKE_SPIKES, 2 + GESTURE_SHAKE_GAP, 0, 1500 ) ;
+  CHECK( trace.gesturesNum == 1  &&  trace.gestures[0] == GESTURE_SHAKE ) ;
+
+  trace = run( GESTURE_SHAKE_SPIKES, 2 + GESTURE_SHAKE_GAP + 1, 0, 1500 ) ;
+  CHECK( trace.gesturesNum == GESTURE_SHAKE_SPIKES ) ;
+
+  for (int i = 0  ;  i < trace.gesturesNum  ;  ++i)
+    CHECK( trace.gestures[i] == GESTURE_PUNCH ) ;
+
+  // Fewer spikes than a shake: one punch, with the group strongest peak.
+  trace = run( GESTURE_SHAKE_SPIKES - 1, 4, 0, 1500 ) ;
+  CHECK( trace.gesturesNum == 1  &&  trace.gestures[0] == GESTURE_PUNCH ) ;
+}
+
+
+static
+void
+test_posture
+( )
+{ // A long lasting offset is a posture change: no gesture, and the new posture becomes the rest.
+  GestureRecognizer recognizer ;
+  GestureRecognizer_initialize( &recognizer, REST_X, REST_Y, REST_Z ) ;
+
+  Trace trace = { .gesturesNum = 0, .samples = 0 } ;
+
+  push( &recognizer, &trace, TRACE_GAP, 0, 0, 0 ) ;
+  push( &recognizer, &trace, 4 * TRACE_GAP, 900, 0, 0 ) ;
+  CHECK( trace.gesturesNum == 0 ) ;
+
+  // A punch over the new posture.
+  push( &recognizer, &trace, 2, 900 + 1500, 0, 0 ) ;
+  push( &recognizer, &trace, TRACE_GAP, 900, 0, 0 ) ;
+  CHECK( trace.gesturesNum == 1  &&  trace.gestures[0] == GESTURE_PUNCH ) ;
+}
+
+
+int
+main
+( )
+{
+  test_single( ) ;
+  test_shake( ) ;
+  test_posture( ) ;
+
+  return TEST_RESULT( ) ;
+}
@@ -0,0 +1,129 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : test/GovernorTest.c
+
+   Governor trace: frame costs and battery states in, tiers out.
+
+   Last revision: 16 October 2026
+*/
+
+#include "Governor.h"
+#include "Test.h"
+
+
+// Feeds frames frames of cost_ms each. Returns the tier changes, *minGap gets the fewest frames between two of them.
+static
+int
+feed
+( Governor *governor
+, int       frames
+, uint32_t  cost_ms
+, int      *minGap
+)
+{
+  int changes  = 0 ;
+  int lastAt   = -1 ;
+
+  *minGap = frames ;
+
+  for (int frame = 0  ;  frame < frames  ;  ++frame)
+    if (Governor_frameCost( governor, cost_ms ))
+    {
+      if (lastAt >= 0  &&  frame - lastAt < *minGap)
+        *minGap = frame - lastAt ;
+
+      lastAt = frame ;
+      ++changes ;
+    }
+
+  return changes ;
+}
+
+
+static
+BatteryChargeState
+battery
+( uint8_t  charge_percent
+, bool     is_charging
+)
+{
+  return (BatteryChargeState){ .charge_percent = charge_percent, .is_charging = is_charging, .is_plugged = is_charging } ;
+}
+
+
+static
+void
+test_load
+( )
+{
+  Governor governor ;
+  Governor_initialize( &governor ) ;
+
+  CHECK( Governor_tier( &governor )->interval_ms == 40 ) ;
+
+  int minGap ;
+
+  // Half the 40 ms budget: stays at the best tier.
+  CHECK( feed( &governor, 500, 20, &minGap ) == 0 ) ;
+  CHECK( governor.tier == 0 ) ;
+
+  // 45 ms frames: over 75% of 40 and 50 ms, under 75% of 66 ms => settles at tier 2, one step per hold period.
+  CHECK( feed( &governor, 500, 45, &minGap ) == 2 ) ;
+  CHECK( minGap >= GOVERNOR_HOLD_FRAMES ) ;
+  CHECK( governor.tier == 2 ) ;
+  CHECK( !Governor_tier( &governor )->hundredths ) ;
+  CHECK( !Governor_tier( &governor )->wireframe ) ;
+
+  // Overload: cheapest tier, never past it.
+  CHECK( feed( &governor, 500, 90, &minGap ) == 1 ) ;
+  CHECK( governor.tier == 3 ) ;
+  CHECK( Governor_tier( &governor )->wireframe ) ;
+
+  // Cheap again: back to the best tier, one step per hold period.
+  CHECK( feed( &governor, 500, 10, &minGap ) == 3 ) ;
+  CHECK( minGap >= GOVERNOR_HOLD_FRAMES ) ;
+  CHECK( governor.tier == 0 ) ;
+
+  // Costs between the up and down thresholds of a tier: settles, no flapping.
+  feed( &governor, 500, 35, &minGap ) ;
+  const uint8_t settled = governor.tier ;
+  CHECK( feed( &governor, 1000, 35, &minGap ) == 0 ) ;
+  CHECK( governor.tier == settled ) ;
+}
+
+
+static
+void
+test_battery
+( )
+{
+  Governor governor ;
+  Governor_initialize( &governor ) ;
+
+  CHECK( !Governor_battery( &governor, battery( 80, false ) ) ) ;
+  CHECK(  Governor_battery( &governor, battery( GOVERNOR_BATTERY_LOW_PCT, false ) )  &&  governor.tier == 1 ) ;
+  CHECK(  Governor_battery( &governor, battery( 15, false ) )  &&  governor.tier == 2 ) ;
+  CHECK(  Governor_battery( &governor, battery( 5, false ) )  &&  governor.tier == 3 ) ;
+  CHECK(  Governor_battery( &governor, battery( 5, true ) )  &&  governor.tier == 0 ) ;
+
+  // The battery is a floor: a cheap load stays above it, an expensive one goes below it.
+  Governor_battery( &governor, battery( 25, false ) ) ;
+  int minGap ;
+  feed( &governor, 500, 10, &minGap ) ;
+  CHECK( governor.tier == 1 ) ;
+  feed( &governor, 500, 90, &minGap ) ;
+  CHECK( governor.tier == 3 ) ;
+  Governor_battery( &governor, battery( 100, true ) ) ;
+  CHECK( governor.tier == 3 ) ;
+}
+
+
+int
+main
+( )
+{
+  test_load( ) ;
+  test_battery( ) ;
+
+  return TEST_RESULT( ) ;
+}
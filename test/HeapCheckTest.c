@@ -0,0 +1,116 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : test/HeapCheckTest.c
+
+   No heap use on the per frame paths: the Governor, AccelFilter and GestureRecognizer updates run within
+   HeapCheck passes, with malloc & co routed through the Arena.c wrappers (-Wl,--wrap, see the Makefile).
+
+   Last revision: 16 October 2026
+*/
+
+#include "AccelFilter.h"
+#include "Gesture.h"
+#include "Governor.h"
+#include "HeapCheck.h"
+#include "Test.h"
+
+
+#define REST_X        -81     // main.c STEADY viewPoint attractor.
+#define REST_Y       -816
+#define REST_Z       -571
+
+#define FRAMES        2000
+#define BATCH            5    // main.c ACCEL_SAMPLES_PER_UPDATE.
+
+
+static
+void
+test_wrapped
+( )
+{ // The check itself: a heap call within a pass is counted (and logged), outside of one or during warm-up it is not.
+  const uint32_t callsFailed = HeapCheck_callsFailed( ) ;
+
+  free( malloc( 16 ) ) ;
+  CHECK( HeapCheck_callsFailed( ) == callsFailed ) ;
+
+  HeapCheck_frameBegin( HEAPCHECK_WARMUP_FRAMES ) ;
+  free( malloc( 16 ) ) ;
+  HeapCheck_frameEnd( ) ;
+  CHECK( HeapCheck_callsFailed( ) == callsFailed ) ;
+
+  HeapCheck_frameBegin( HEAPCHECK_WARMUP_FRAMES + 1 ) ;
+  void *block = calloc( 4, 4 ) ;
+  block = realloc( block, 32 ) ;
+  free( block ) ;
+  HeapCheck_frameEnd( ) ;
+  CHECK( HeapCheck_callsFailed( ) == callsFailed + 3 ) ;
+}
+
+
+static
+void
+test_updates
+( )
+{ // main.c per frame use: an accel batch through the filter and the recognizer, then a frame cost and a
+  // battery state to the governor. Spikes, shakes and costs swept so every branch runs.
+  const uint32_t callsFailed = HeapCheck_callsFailed( ) ;
+
+  AccelFilter       filters[3] ;
+  GestureRecognizer recognizer ;
+  Governor          governor ;
+
+  for (AccelFilterKernel kernel = ACCELFILTER_KERNEL_BOXCAR  ;  kernel <= ACCELFILTER_KERNEL_ONEEURO  ;  ++kernel)
+    AccelFilter_initialize( filters + kernel, kernel, REST_X, REST_Y, REST_Z ) ;
+
+  GestureRecognizer_initialize( &recognizer, REST_X, REST_Y, REST_Z ) ;
+  Governor_initialize( &governor ) ;
+
+  int gestures = 0 ;
+
+  for (int frame = 0  ;  frame < FRAMES  ;  ++frame)
+  {
+    HeapCheck_frameBegin( HEAPCHECK_WARMUP_FRAMES + 1 + frame ) ;
+
+    for (int i = 0  ;  i < BATCH  ;  ++i)
+    {
+      const int     sample = frame * BATCH + i ;
+      const int16_t spike  = (sample & 63) < 12  &&  (sample & 3) == 0 ? ((sample & 4) ? -1500 : 1500) : 0 ;
+      const int16_t x      = REST_X + (sample & 7) + ((sample >> 6) % 3 == 0 ? spike : 0) ;
+      const int16_t y      = REST_Y - (sample & 3) + ((sample >> 6) % 3 == 1 ? spike : 0) ;
+      const int16_t z      = REST_Z                + ((sample >> 6) % 3 == 2 ? spike : 0) ;
+
+      for (int k = 0  ;  k < 3  ;  ++k)
+        AccelFilter_push( filters + k, x, y, z ) ;
+
+      int16_t strength ;
+      gestures += GestureRecognizer_push( &recognizer, x, y, z, &strength ) != GESTURE_NONE ;
+    }
+
+    int32_t fx, fy, fz ;
+
+    for (int k = 0  ;  k < 3  ;  ++k)
+      AccelFilter_get( filters + k, &fx, &fy, &fz ) ;
+
+    Governor_frameCost( &governor, (uint32_t)(frame * 7919 % 120) ) ;
+    Governor_battery( &governor, (BatteryChargeState){ .charge_percent = (uint8_t)(100 - frame * 100 / FRAMES), .is_charging = false } ) ;
+    Governor_tier( &governor ) ;
+
+    HeapCheck_frameEnd( ) ;
+  }
+
+  printf( "HeapCheck %d frames, %d gestures: %d heap calls\n", FRAMES, gestures, (int)(HeapCheck_callsFailed( ) - callsFailed) ) ;
+  CHECK( gestures > 0 ) ;
+  CHECK( HeapCheck_callsFailed( ) == callsFailed ) ;
+}
+
+
+int
+main
+( )
+{
+  test_updates( ) ;
+  HeapCheck_report( ) ;
+  test_wrapped( ) ;
+
+  return TEST_RESULT( ) ;
+}
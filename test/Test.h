@@ -0,0 +1,26 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : test/Test.h
+
+   Host test helpers: CHECK( ) logs a failed condition and counts it, TEST_RESULT( ) is main( )'s exit status.
+
+   Last revision: 16 October 2026
+*/
+
+#pragma once
+
+#include <stdio.h>
+
+
+static int s_test_failures = 0 ;
+
+#define CHECK(condition)                                                                 \
+  do                                                                                     \
+  { if (!(condition))                                                                    \
+    { printf( "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition ) ;            \
+      ++s_test_failures ;                                                                \
+    }                                                                                    \
+  } while (0)
+
+#define TEST_RESULT()                                                                    \
+  ( printf( "%s: %s\n", __FILE__, s_test_failures == 0 ? "PASS" : "FAIL" ), s_test_failures != 0 )
@@ -0,0 +1,33 @@
+/*
+   WatchApp: Flip Clock 3D
+   File    : test/stub/pebble.h
+
+   Minimal host stand-in for the Pebble SDK header: only what the host tested modules use.
+
+   Last revision: 16 October 2026
+*/
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+typedef enum { APP_LOG_LEVEL_ERROR   =   1
+             , APP_LOG_LEVEL_WARNING =  50
+             , APP_LOG_LEVEL_INFO    = 100
+             , APP_LOG_LEVEL_DEBUG   = 200
+             }
+AppLogLevel ;
+
+#define APP_LOG(level, fmt, ...)   printf( "[%d] " fmt "\n", (int)(level), ##__VA_ARGS__ )
+
+
+typedef struct
+{ uint8_t  charge_percent ;
+  bool     is_charging ;
+  bool     is_plugged ;
+} BatteryChargeState ;